@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../containers/algorithms.h"
+#include "../containers/list.h"
+#include "../containers/vector.h"
+#include "bench_common.h"
+
+using s21_bench::Fill;
+using s21_bench::RandomValues;
+
+// алгоритмы s21 с политиками на 10^7 элементов: range(0) — число потоков
+// пула, 0 — execution::seq. Контейнер строится один раз вне замера.
+// Реальный прирост ограничен числом ядер машины
+
+namespace {
+
+constexpr std::size_t kElements = 10000000;
+
+void ThreadArgs(benchmark::internal::Benchmark* bench) {
+  bench->Arg(0);
+  for (long threads = 1; threads <= 16; threads *= 2) bench->Arg(threads);
+  bench->ArgName("threads")->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+template <typename Container>
+const Container& Elements() {
+  static const Container container = [] {
+    Container result;
+    Fill(result, RandomValues<int>(kElements));
+    return result;
+  }();
+  return container;
+}
+
+// вызывает body с seq или с par на пуле из range(0) потоков
+template <typename Body>
+void RunWithPolicy(benchmark::State& state, Body body) {
+  const std::size_t threads = static_cast<std::size_t>(state.range(0));
+  s21::thread_pool pool(threads == 0 ? 1 : threads);
+  for (auto _ : state) {
+    if (threads == 0)
+      body(s21::execution::seq);
+    else
+      body(s21::execution::par.on(pool));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(kElements));
+}
+
+}  // namespace
+
+// немного арифметики на элемент, чтобы нагрузка не сводилась к чтению памяти
+template <typename Container>
+static void BM_AlgoForEach(benchmark::State& state) {
+  Container container = Elements<Container>();
+  RunWithPolicy(state, [&container](const auto& policy) {
+    s21::for_each(policy, container.begin(), container.end(), [](int& value) { value = value * 7 + 3; });
+    benchmark::ClobberMemory();
+  });
+}
+
+template <typename Container>
+static void BM_AlgoTransform(benchmark::State& state) {
+  const Container& container = Elements<Container>();
+  std::vector<double> out(kElements);
+  RunWithPolicy(state, [&container, &out](const auto& policy) {
+    s21::transform(policy, container.begin(), container.end(), out.begin(),
+                   [](int value) { return std::sqrt(static_cast<double>(value & 0xffff)); });
+    benchmark::ClobberMemory();
+  });
+}
+
+template <typename Container>
+static void BM_AlgoReduce(benchmark::State& state) {
+  const Container& container = Elements<Container>();
+  RunWithPolicy(state, [&container](const auto& policy) {
+    benchmark::DoNotOptimize(s21::reduce(policy, container.begin(), container.end(), 0LL));
+  });
+}
+
+template <typename Container>
+static void BM_AlgoCountIf(benchmark::State& state) {
+  const Container& container = Elements<Container>();
+  RunWithPolicy(state, [&container](const auto& policy) {
+    benchmark::DoNotOptimize(
+        s21::count_if(policy, container.begin(), container.end(), [](int value) { return value % 3 == 0; }));
+  });
+}
+
+// искомого нет: просматривается весь диапазон
+template <typename Container>
+static void BM_AlgoFindIf(benchmark::State& state) {
+  const Container& container = Elements<Container>();
+  RunWithPolicy(state, [&container](const auto& policy) {
+    auto found = s21::find_if(policy, container.begin(), container.end(), [](int value) { return value == -1; });
+    benchmark::DoNotOptimize(found);
+  });
+}
+
+template <typename Container>
+static void BM_AlgoCopyIf(benchmark::State& state) {
+  const Container& container = Elements<Container>();
+  std::vector<int> out(kElements);
+  RunWithPolicy(state, [&container, &out](const auto& policy) {
+    auto end = s21::copy_if(policy, container.begin(), container.end(), out.begin(),
+                            [](int value) { return value % 2 == 0; });
+    benchmark::DoNotOptimize(end);
+  });
+}
+
+#define S21_ALGO_BENCH(func)                                    \
+  BENCHMARK_TEMPLATE(func, s21::vector<int>)->Apply(ThreadArgs); \
+  BENCHMARK_TEMPLATE(func, s21::list<int>)->Apply(ThreadArgs)
+
+S21_ALGO_BENCH(BM_AlgoForEach);
+S21_ALGO_BENCH(BM_AlgoTransform);
+S21_ALGO_BENCH(BM_AlgoReduce);
+S21_ALGO_BENCH(BM_AlgoCountIf);
+S21_ALGO_BENCH(BM_AlgoFindIf);
+S21_ALGO_BENCH(BM_AlgoCopyIf);
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "../containers/array.h"
+#include "bench_common.h"
+
+// таблицы на s21::array, построенные при компиляции, против тех же таблиц,
+// построенных во время выполнения. BM_TableBuild* — цена, которую платит
+// программа на старте (или при первом обращении), если таблица не constexpr;
+// у constexpr-таблиц её нет: данные лежат в бинарнике готовыми, что
+// проверяет static_assert ниже. BM_TableLookup* сравнивают сами обращения
+
+namespace {
+
+constexpr std::uint32_t kCrcPolynomial = 0xEDB88320u;
+constexpr std::uint32_t kKeySeed = 2024;
+
+// CRC-32, классическая таблица на 256 значений
+constexpr s21::array<std::uint32_t, 256> MakeCrcTable(std::uint32_t polynomial) {
+  s21::array<std::uint32_t, 256> table{};
+  for (std::uint32_t i = 0; i < 256; ++i) {
+    std::uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ (polynomial & (0u - (crc & 1u)));
+    table[i] = crc;
+  }
+  return table;
+}
+
+// отсортированные псевдослучайные ключи для двоичного поиска
+constexpr s21::array<std::uint32_t, 4096> MakeSortedKeys(std::uint32_t seed) {
+  s21::array<std::uint32_t, 4096> keys{};
+  for (std::uint32_t& key : keys) {
+    seed = seed * 1664525u + 1013904223u;
+    key = seed >> 4;
+  }
+  s21::constexpr_sort(keys.begin(), keys.end());
+  return keys;
+}
+
+constexpr auto kCrcTable = MakeCrcTable(kCrcPolynomial);
+constexpr auto kSortedKeys = MakeSortedKeys(kKeySeed);
+static_assert(kCrcTable[1] == 0x77073096u, "CRC table is built at compile time");
+static_assert(kSortedKeys.front() <= kSortedKeys.back(), "keys are sorted at compile time");
+
+// та же таблица, но построенная при первом обращении
+const s21::array<std::uint32_t, 4096>& LazySortedKeys() {
+  static const s21::array<std::uint32_t, 4096> keys = [] {
+    std::uint32_t seed = kKeySeed;
+    benchmark::DoNotOptimize(seed);  // не даёт компилятору построить таблицу заранее
+    return MakeSortedKeys(seed);
+  }();
+  return keys;
+}
+
+}  // namespace
+
+static void BM_TableBuildCrc(benchmark::State& state) {
+  std::uint32_t polynomial = kCrcPolynomial;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(polynomial);
+    auto table = MakeCrcTable(polynomial);
+    benchmark::DoNotOptimize(table);
+  }
+}
+BENCHMARK(BM_TableBuildCrc);
+
+static void BM_TableBuildSortedKeys(benchmark::State& state) {
+  std::uint32_t seed = kKeySeed;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(seed);
+    auto keys = MakeSortedKeys(seed);
+    benchmark::DoNotOptimize(keys);
+  }
+}
+BENCHMARK(BM_TableBuildSortedKeys);
+
+// constexpr-массив, переменная времени компиляции: обращение без проверки
+// "уже построено?", которую делает локальная static-переменная
+static void BM_TableLookupConstexpr(benchmark::State& state) {
+  const auto probes = s21_bench::RandomValues<int>(1024);
+  std::size_t next = 0;
+  for (auto _ : state) {
+    const std::uint32_t probe = static_cast<std::uint32_t>(probes[next++ & 1023]);
+    benchmark::DoNotOptimize(s21::constexpr_lower_bound(kSortedKeys.begin(), kSortedKeys.end(), probe));
+  }
+}
+BENCHMARK(BM_TableLookupConstexpr);
+
+static void BM_TableLookupLazyStatic(benchmark::State& state) {
+  const auto probes = s21_bench::RandomValues<int>(1024);
+  std::size_t next = 0;
+  for (auto _ : state) {
+    const std::uint32_t probe = static_cast<std::uint32_t>(probes[next++ & 1023]);
+    const auto& keys = LazySortedKeys();
+    benchmark::DoNotOptimize(s21::constexpr_lower_bound(keys.begin(), keys.end(), probe));
+  }
+}
+BENCHMARK(BM_TableLookupLazyStatic);
+
+static void BM_TableCrcChecksum(benchmark::State& state) {
+  const std::vector<int> bytes = s21_bench::RandomValues<int>(4096);
+  for (auto _ : state) {
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (int byte : bytes) crc = kCrcTable[(crc ^ static_cast<std::uint32_t>(byte)) & 0xFFu] ^ (crc >> 8);
+    benchmark::DoNotOptimize(crc);
+  }
+  state.SetBytesProcessed(state.iterations() * 4096);
+}
+BENCHMARK(BM_TableCrcChecksum);
@@ -0,0 +1,109 @@
+#ifndef S21_CONTAINERS_BENCHMARKS_BENCH_COMMON_H
+#define S21_CONTAINERS_BENCHMARKS_BENCH_COMMON_H
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+// Общие части бенчмарков: типы элементов от int до 1 КБ, генерация значений
+// и набор размеров 10..10^7, урезанный по памяти для тяжёлых типов.
+
+namespace s21_bench {
+
+// тяжёлые элементы: ключ сравнения + балласт
+template <std::size_t Size>
+struct Payload {
+  int key;
+  char bytes[Size - sizeof(int)];
+  bool operator<(const Payload& other) const { return key < other.key; }
+  bool operator==(const Payload& other) const { return key == other.key; }
+};
+
+using Payload256 = Payload<256>;
+using Payload1K = Payload<1024>;
+
+template <typename T>
+T MakeValue(unsigned value);
+
+template <>
+inline int MakeValue<int>(unsigned value) {
+  return static_cast<int>(value);
+}
+
+// строки длиннее SSO-буфера, чтобы каждая жила в куче
+template <>
+inline std::string MakeValue<std::string>(unsigned value) {
+  std::string digits = std::to_string(value);
+  return std::string(10 - std::min<std::size_t>(digits.size(), 10), '0') + digits +
+         "_padding_to_avoid_sso";
+}
+
+template <>
+inline Payload256 MakeValue<Payload256>(unsigned value) {
+  Payload256 payload{};
+  payload.key = static_cast<int>(value);
+  return payload;
+}
+
+template <>
+inline Payload1K MakeValue<Payload1K>(unsigned value) {
+  Payload1K payload{};
+  payload.key = static_cast<int>(value);
+  return payload;
+}
+
+// что-то, что можно сложить при обходе, чтобы компилятор не выкинул цикл
+inline long long Touch(int value) { return value; }
+inline long long Touch(const std::string& value) {
+  return static_cast<long long>(value.size());
+}
+template <std::size_t Size>
+inline long long Touch(const Payload<Size>& value) {
+  return value.key;
+}
+
+// n случайных значений; modulo > 0 ограничивает число различных ключей
+template <typename T>
+std::vector<T> RandomValues(std::size_t n, unsigned modulo = 0) {
+  std::mt19937 gen(42);
+  std::vector<T> values;
+  values.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    unsigned value = gen();
+    values.push_back(MakeValue<T>(modulo != 0 ? value % modulo : value));
+  }
+  return values;
+}
+
+template <typename Container, typename T>
+void Fill(Container& container, const std::vector<T>& values) {
+  for (const T& value : values) container.push_back(value);
+}
+
+// 10, 100, ..., 10^7, пока контейнер укладывается примерно в kMaxBytes
+// (значения + узел + исходный вектор значений)
+constexpr std::size_t kMaxBytes = std::size_t{512} << 20;
+
+template <typename T>
+void SizeRange(benchmark::internal::Benchmark* bench) {
+  const std::size_t perElement = 2 * sizeof(T) + 2 * sizeof(void*) + 16;
+  for (long long n = 10; n <= 10000000; n *= 10) {
+    if (static_cast<std::size_t>(n) * perElement > kMaxBytes) break;
+    bench->Arg(n);
+  }
+}
+
+}  // namespace s21_bench
+
+// регистрирует бенчмарк для s21-контейнера и парного std-контейнера
+#define S21_BENCH_PAIR(func, s21_type, std_type, value_type)   \
+  BENCHMARK_TEMPLATE(func, s21_type)                            \
+      ->Apply(s21_bench::SizeRange<value_type>);                \
+  BENCHMARK_TEMPLATE(func, std_type)                            \
+      ->Apply(s21_bench::SizeRange<value_type>)
+
+#endif  // S21_CONTAINERS_BENCHMARKS_BENCH_COMMON_H
@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../containers/list.h"
+#include "../containers/mpmc_queue.h"
+#include "../containers/queue.h"
+#include "../containers/spsc_queue.h"
+
+// Передача элементов между потоками: spsc_queue, mpmc_queue и то, что было
+// до них, — s21::queue на списке под мьютексом. Половина потоков кладёт,
+// половина забирает; элемент — момент, когда его положили, поэтому
+// потребитель заодно меряет задержку доставки. Отчёт: items_per_second
+// (push + pop всех потоков) и p99_ns — 99-й перцентиль задержки по общей
+// выборке всех потребителей.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+constexpr size_t kQueueCapacity = 1024;
+// задержка пишется у каждого kSampleEvery-го элемента
+constexpr size_t kSampleEvery = 16;
+
+long long NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+// прежняя схема для сравнения: ограниченная очередь на списке под мьютексом
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(long long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(long long& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<long long, s21::list<long long>> queue_;
+  size_t capacity_;
+};
+
+// одна очередь на тип на весь прогон: к концу каждого замера она пуста,
+// потому что каждый поток делает одинаковое число итераций
+template <typename Queue>
+Queue& SharedQueue() {
+  static Queue queue(kQueueCapacity);
+  return queue;
+}
+
+// задержки всех потребителей одного замера. Перцентили не усредняются,
+// поэтому каждый потребитель после замера дописывает сюда свои отсчёты,
+// а последний считает p99 по общей выборке
+struct LatencySamples {
+  std::mutex mutex;
+  std::vector<long long> samples;
+  int reported = 0;
+};
+
+template <typename Queue>
+LatencySamples& SharedSamples() {
+  static LatencySamples samples;
+  return samples;
+}
+
+template <typename Queue>
+void Produce(benchmark::State& state, Queue& queue) {
+  for (auto _ : state) {
+    while (!queue.try_push(NowNs())) std::this_thread::yield();
+  }
+}
+
+template <typename Queue>
+void Consume(benchmark::State& state, Queue& queue, int consumers) {
+  std::vector<long long> latencies;
+  size_t received = 0;
+  for (auto _ : state) {
+    long long stamp;
+    while (!queue.try_pop(stamp)) std::this_thread::yield();
+    if (received++ % kSampleEvery == 0) latencies.push_back(NowNs() - stamp);
+  }
+  // счётчики потоков суммируются: у всех, кроме последнего, p99_ns — ноль
+  LatencySamples& shared = SharedSamples<Queue>();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  shared.samples.insert(shared.samples.end(), latencies.begin(), latencies.end());
+  double p99_ns = 0;
+  if (++shared.reported == consumers) {
+    if (!shared.samples.empty()) {
+      auto p99 = shared.samples.begin() + static_cast<long>(shared.samples.size() * 99 / 100);
+      std::nth_element(shared.samples.begin(), p99, shared.samples.end());
+      p99_ns = static_cast<double>(*p99);
+    }
+    shared.samples.clear();
+    shared.reported = 0;
+  }
+  state.counters["p99_ns"] = p99_ns;
+}
+
+void ThreadPairs(benchmark::internal::Benchmark* bench) {
+  for (int threads = 2; threads <= 64; threads *= 2) bench->Threads(threads);
+}
+
+}  // namespace
+
+static void BM_SpscTransfer(benchmark::State& state) {
+  auto& queue = SharedQueue<s21::spsc_queue<long long>>();
+  if (state.thread_index() == 0)
+    Produce(state, queue);
+  else
+    Consume(state, queue, 1);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SpscTransfer)->Threads(2)->UseRealTime();
+
+// чётные потоки кладут, нечётные забирают: 1..32 пар
+template <typename Queue>
+static void BM_MpmcTransfer(benchmark::State& state) {
+  auto& queue = SharedQueue<Queue>();
+  if (state.thread_index() % 2 == 0)
+    Produce(state, queue);
+  else
+    Consume(state, queue, state.threads() / 2);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_MpmcTransfer, s21::mpmc_queue<long long>)->Apply(ThreadPairs)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MpmcTransfer, LockedQueue)->Apply(ThreadPairs)->UseRealTime();
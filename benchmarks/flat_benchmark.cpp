@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../containers/flat_map.h"
+#include "../containers/flat_set.h"
+#include "../containers/map.h"
+#include "bench_common.h"
+
+// Задержка поиска во flat_map рядом с деревьями s21::map и std::map.
+// Каждый следующий ключ берётся по значению, найденному предыдущим
+// поиском, поэтому поиски не перекрываются и замер показывает именно
+// задержку, а не пропускную способность. Размеры подобраны так, чтобы
+// flat_map<int, int> (8 байт на пару) занимал порядка L1, L2, LLC и DRAM;
+// деревья на тех же числах ключей занимают в 5–6 раз больше.
+
+namespace {
+
+struct WorkingSet {
+  long long entries;
+  const char* label;
+};
+
+const WorkingSet kWorkingSets[] = {
+    {1 << 11, "L1 16KB"},
+    {1 << 17, "L2 1MB"},
+    {1 << 22, "LLC 32MB"},
+    {1 << 25, "DRAM 256MB"},
+};
+
+void FlatSizes(benchmark::internal::Benchmark* bench) {
+  for (const WorkingSet& set : kWorkingSets) bench->Arg(set.entries);
+}
+
+// деревья на 2^25 ключей заняли бы гигабайты — им хватает первых трёх
+void TreeSizes(benchmark::internal::Benchmark* bench) {
+  for (const WorkingSet& set : kWorkingSets)
+    if (set.entries <= (1 << 22)) bench->Arg(set.entries);
+}
+
+const char* LabelFor(long long entries) {
+  for (const WorkingSet& set : kWorkingSets)
+    if (set.entries == entries) return set.label;
+  return "";
+}
+
+// ключи — чётные числа в случайном порядке, значение ключа — индекс
+// следующего ключа в этом же порядке: так строится цепочка поисков,
+// обходящая все ключи
+std::vector<std::pair<int, int>> ChainEntries(size_t n) {
+  std::vector<int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937(11));
+  std::vector<std::pair<int, int>> entries(n);
+  for (size_t i = 0; i < n; ++i)
+    entries[i] = {order[i] * 2, static_cast<int>((i + 1) % n)};
+  return entries;
+}
+
+template <typename Map>
+Map Build(const std::vector<std::pair<int, int>>& entries) {
+  Map map;
+  for (const auto& entry : entries) map.insert(entry);
+  return map;
+}
+
+template <>
+s21::flat_map<int, int> Build(const std::vector<std::pair<int, int>>& entries) {
+  return s21::flat_map<int, int>(entries.begin(), entries.end());
+}
+
+}  // namespace
+
+template <typename Map>
+static void BM_LookupLatency(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  const std::vector<std::pair<int, int>> entries = ChainEntries(n);
+  const Map map = Build<Map>(entries);
+  int index = 0;
+  for (auto _ : state) {
+    index = map.find(entries[static_cast<size_t>(index)].first)->second;
+    benchmark::DoNotOptimize(index);
+  }
+  state.SetLabel(LabelFor(state.range(0)));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_LookupLatency, s21::flat_map<int, int>)->Apply(FlatSizes);
+BENCHMARK_TEMPLATE(BM_LookupLatency, s21::map<int, int>)->Apply(TreeSizes);
+BENCHMARK_TEMPLATE(BM_LookupLatency, std::map<int, int>)->Apply(TreeSizes);
+
+// независимые поиски: сколько contains в секунду даёт каждая структура
+template <typename Map>
+static void BM_LookupThroughput(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  const std::vector<std::pair<int, int>> entries = ChainEntries(n);
+  const Map map = Build<Map>(entries);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(entries[i].first));
+    i = i + 1 == n ? 0 : i + 1;
+  }
+  state.SetLabel(LabelFor(state.range(0)));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_LookupThroughput, s21::flat_map<int, int>)->Apply(FlatSizes);
+BENCHMARK_TEMPLATE(BM_LookupThroughput, s21::map<int, int>)->Apply(TreeSizes);
+BENCHMARK_TEMPLATE(BM_LookupThroughput, std::map<int, int>)->Apply(TreeSizes);
+
+// построение пачкой из неотсортированного диапазона
+static void BM_FlatSetBuild(benchmark::State& state) {
+  const std::vector<int> values = s21_bench::RandomValues<int>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    s21::flat_set<int> set(values.begin(), values.end());
+    benchmark::DoNotOptimize(set.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FlatSetBuild)->RangeMultiplier(10)->Range(1000, 1000000);
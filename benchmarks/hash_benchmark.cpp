@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../containers/unordered_map.h"
+#include "bench_common.h"
+
+// s21::unordered_map (открытая адресация, группы по 16 байтов) против
+// std::unordered_map (цепочки узлов) на четырёх нагрузках: успешный поиск,
+// промах, вставка с нуля и смесь, где половина операций — удаления.
+// Размеры — от таблицы в L1 до таблицы, заметно большей L2.
+
+namespace {
+
+void HashSizes(benchmark::internal::Benchmark* bench) {
+  for (long long n : {1 << 10, 1 << 16, 1 << 20, 1 << 23}) bench->Arg(n);
+}
+
+// строки живут в куче по отдельности — 2^23 таких ключей не влезают в память
+void StringSizes(benchmark::internal::Benchmark* bench) {
+  for (long long n : {1 << 10, 1 << 16, 1 << 20}) bench->Arg(n);
+}
+
+// ключи таблицы — чётные, промахи — нечётные: так промах гарантирован,
+// а распределение хешей у попаданий и промахов одинаковое
+template <typename T>
+std::vector<T> Keys(size_t n, unsigned parity) {
+  std::vector<int> raw = s21_bench::RandomValues<int>(n);
+  std::vector<T> keys;
+  keys.reserve(n);
+  for (int value : raw)
+    keys.push_back(s21_bench::MakeValue<T>((static_cast<unsigned>(value) & ~1u) | parity));
+  return keys;
+}
+
+template <typename Map>
+Map Build(const std::vector<typename Map::key_type>& keys) {
+  Map map;
+  for (const auto& key : keys) map.insert({key, 1});
+  return map;
+}
+
+}  // namespace
+
+template <typename Map>
+static void BM_HashFindHit(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  const auto keys = Keys<typename Map::key_type>(n, 0);
+  const Map map = Build<Map>(keys);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(keys[i]));
+    i = i + 1 == n ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+static void BM_HashFindMiss(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  const Map map = Build<Map>(Keys<typename Map::key_type>(n, 0));
+  const auto misses = Keys<typename Map::key_type>(n, 1);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(misses[i]));
+    i = i + 1 == n ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// n вставок в пустую таблицу, рост включён в замер
+template <typename Map>
+static void BM_HashInsert(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  const auto keys = Keys<typename Map::key_type>(n, 0);
+  for (auto _ : state) {
+    Map map;
+    for (const auto& key : keys) map.insert({key, 1});
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// скользящее окно: каждая итерация удаляет самый старый ключ и вставляет
+// новый, размер таблицы постоянен. Для открытой адресации это худший
+// случай — удалённые слоты копятся, пока таблица не перестроится
+template <typename Map>
+static void BM_HashEraseHeavy(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  const auto keys = Keys<typename Map::key_type>(2 * n, 0);
+  Map map = Build<Map>(std::vector<typename Map::key_type>(keys.begin(), keys.begin() + static_cast<long>(n)));
+  size_t oldest = 0;
+  size_t next = n;
+  for (auto _ : state) {
+    map.erase(keys[oldest]);
+    map.insert({keys[next], 1});
+    oldest = oldest + 1 == keys.size() ? 0 : oldest + 1;
+    next = next + 1 == keys.size() ? 0 : next + 1;
+  }
+  benchmark::DoNotOptimize(map.size());
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+#define S21_HASH_BENCH(func, key_type, sizes)                             \
+  BENCHMARK_TEMPLATE(func, s21::unordered_map<key_type, int>)->Apply(sizes); \
+  BENCHMARK_TEMPLATE(func, std::unordered_map<key_type, int>)->Apply(sizes)
+
+S21_HASH_BENCH(BM_HashFindHit, int, HashSizes);
+S21_HASH_BENCH(BM_HashFindHit, std::string, StringSizes);
+S21_HASH_BENCH(BM_HashFindMiss, int, HashSizes);
+S21_HASH_BENCH(BM_HashFindMiss, std::string, StringSizes);
+S21_HASH_BENCH(BM_HashInsert, int, HashSizes);
+S21_HASH_BENCH(BM_HashEraseHeavy, int, HashSizes);
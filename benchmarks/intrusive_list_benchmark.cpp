@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "../containers/intrusive_list.h"
+#include "../containers/list.h"
+#include "bench_common.h"
+
+using s21_bench::RandomValues;
+
+// LRU: n объектов лежат в арене (векторе), каждое обращение переносит
+// объект в голову списка. s21::list хранит копии в своих узлах, поэтому
+// перенос — erase + push_front (освобождение и выделение узла) и
+// обновление индекса ключ -> итератор; intrusive_list переносит сам
+// объект одним splice без выделений.
+
+namespace {
+
+struct Entry {
+  int key;
+  char payload[52];
+  s21::list_hook hook;
+};
+
+using EntryList = s21::intrusive_list<Entry, &Entry::hook>;
+
+// случайные обращения с повторами: ключи берутся из первой четверти чаще
+std::vector<unsigned> Touches(std::size_t n) {
+  std::vector<unsigned> touches;
+  touches.reserve(n);
+  for (int value : RandomValues<int>(n)) {
+    unsigned index = static_cast<unsigned>(value) % n;
+    touches.push_back(index % 2 == 0 ? index / 4 : index);
+  }
+  return touches;
+}
+
+}  // namespace
+
+static void BM_LruTouchList(benchmark::State& state) {
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  const auto touches = Touches(n);
+  s21::list<Entry> lru;
+  std::vector<s21::list<Entry>::iterator> index(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    lru.push_front(Entry{static_cast<int>(i), {}, {}});
+    index[i] = lru.begin();
+  }
+  std::size_t next = 0;
+  for (auto _ : state) {
+    unsigned key = touches[next];
+    next = next + 1 == n ? 0 : next + 1;
+    Entry entry = *index[key];
+    lru.erase(index[key]);
+    lru.push_front(entry);
+    index[key] = lru.begin();
+  }
+  benchmark::DoNotOptimize(lru.front().key);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LruTouchList)->Range(1 << 10, 1 << 20);
+
+static void BM_LruTouchIntrusive(benchmark::State& state) {
+  const std::size_t n = static_cast<std::size_t>(state.range(0));
+  const auto touches = Touches(n);
+  std::vector<Entry> arena(n);
+  EntryList lru;
+  for (std::size_t i = 0; i < n; ++i) {
+    arena[i].key = static_cast<int>(i);
+    lru.push_front(arena[i]);
+  }
+  std::size_t next = 0;
+  for (auto _ : state) {
+    unsigned key = touches[next];
+    next = next + 1 == n ? 0 : next + 1;
+    lru.splice(lru.begin(), lru, EntryList::iterator_to(arena[key]));
+  }
+  benchmark::DoNotOptimize(lru.front().key);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LruTouchIntrusive)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,598 @@
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../containers/list.h"
+#include "../containers/pool_allocator.h"
+#include "bench_common.h"
+
+using s21_bench::Fill;
+using s21_bench::MakeValue;
+using s21_bench::Payload1K;
+using s21_bench::Payload256;
+using s21_bench::RandomValues;
+using s21_bench::Touch;
+
+// Каждая операция s21::list меряется рядом с той же операцией std::list на
+// элементах int, std::string, 256 байт и 1 КБ. Если операция портит список
+// (sort, unique, merge), он перестраивается вне замера.
+
+// регистрирует func<s21::list<T>> и func<std::list<T>> для всех типов
+#define S21_LIST_BENCH(func)                                                 \
+  S21_BENCH_PAIR(func, s21::list<int>, std::list<int>, int);                 \
+  S21_BENCH_PAIR(func, s21::list<std::string>, std::list<std::string>,       \
+                 std::string);                                               \
+  S21_BENCH_PAIR(func, s21::list<Payload256>, std::list<Payload256>,         \
+                 Payload256);                                                \
+  S21_BENCH_PAIR(func, s21::list<Payload1K>, std::list<Payload1K>, Payload1K)
+
+// --------------------------- вставка/удаление на концах ---------------------------
+
+template <typename List>
+static void BM_PushBackPopFront(benchmark::State& state) {
+  using T = typename List::value_type;
+  const size_t n = static_cast<size_t>(state.range(0));
+  const T value = MakeValue<T>(1);
+  List list;
+  for (auto _ : state) {
+    for (size_t i = 0; i < n; ++i) list.push_back(value);
+    for (size_t i = 0; i < n; ++i) list.pop_front();
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+S21_LIST_BENCH(BM_PushBackPopFront);
+
+template <typename List>
+static void BM_PushFrontPopBack(benchmark::State& state) {
+  using T = typename List::value_type;
+  const size_t n = static_cast<size_t>(state.range(0));
+  const T value = MakeValue<T>(1);
+  List list;
+  for (auto _ : state) {
+    for (size_t i = 0; i < n; ++i) list.push_front(value);
+    for (size_t i = 0; i < n; ++i) list.pop_back();
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+S21_LIST_BENCH(BM_PushFrontPopBack);
+
+// ----------------------------------- обход -----------------------------------
+
+template <typename List>
+static void BM_IterateForward(benchmark::State& state) {
+  using T = typename List::value_type;
+  List list;
+  Fill(list, RandomValues<T>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += Touch(*it);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_LIST_BENCH(BM_IterateForward);
+
+template <typename List>
+static void BM_IterateBackward(benchmark::State& state) {
+  using T = typename List::value_type;
+  List list;
+  Fill(list, RandomValues<T>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    long long sum = 0;
+    auto it = list.end();
+    while (it != list.begin()) sum += Touch(*--it);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_LIST_BENCH(BM_IterateBackward);
+
+// ---------------------------- доступ по индексу ------------------------------
+// у std::list нет operator[], поэтому рядом — проход std::next от головы,
+// как было в s21::list до курсора
+
+template <typename T>
+static T& IndexAt(s21::list<T>& list, size_t index) {
+  return list[index];
+}
+
+template <typename T>
+static T& IndexAt(std::list<T>& list, size_t index) {
+  return *std::next(list.begin(), static_cast<long>(index));
+}
+
+// for (i...) l[i]: с курсором O(1) на обращение, без него — O(i)
+template <typename List>
+static void BM_IndexSequential(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  List list;
+  Fill(list, RandomValues<int>(n));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (size_t i = 0; i < n; ++i) sum += IndexAt(list, i);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_IndexSequential, s21::list<int>)->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK_TEMPLATE(BM_IndexSequential, std::list<int>)->RangeMultiplier(10)->Range(10, 10000);
+
+// случайные индексы: от ближайшего конца или курсора — в среднем n/4 шагов
+template <typename List>
+static void BM_IndexRandom(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  List list;
+  Fill(list, RandomValues<int>(n));
+  const std::vector<int> raw = RandomValues<int>(1024);
+  std::vector<size_t> indices;
+  for (int value : raw) indices.push_back(static_cast<unsigned>(value) % n);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(IndexAt(list, indices[i]));
+    i = (i + 1) & 1023;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_IndexRandom, s21::list<int>)->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK_TEMPLATE(BM_IndexRandom, std::list<int>)->RangeMultiplier(10)->Range(10, 100000);
+
+// ----------------------- вставка/удаление в середине -----------------------
+// список длины N строится один раз, затем в его середине крутится
+// пара insert + erase; время на операцию не должно расти вместе с N
+
+template <typename List>
+static void BM_InsertEraseMiddle(benchmark::State& state) {
+  using T = typename List::value_type;
+  const size_t n = static_cast<size_t>(state.range(0));
+  const T value = MakeValue<T>(42);
+  List list;
+  Fill(list, RandomValues<T>(n));
+  auto it = list.begin();
+  for (size_t i = 0; i < n / 2; ++i) ++it;
+
+  for (auto _ : state) {
+    it = list.insert(it, value);
+    it = list.erase(it);
+    benchmark::DoNotOptimize(it);
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+S21_LIST_BENCH(BM_InsertEraseMiddle);
+
+// --------------------------- sort / unique / merge ---------------------------
+
+template <typename List>
+static void BM_Sort(benchmark::State& state) {
+  using T = typename List::value_type;
+  const std::vector<T> values = RandomValues<T>(static_cast<size_t>(state.range(0)));
+  List list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    list.clear();
+    Fill(list, values);
+    state.ResumeTiming();
+    list.sort();
+    benchmark::DoNotOptimize(list.front());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_LIST_BENCH(BM_Sort);
+
+// отсортированный список, в котором каждый ключ повторяется ~2 раза
+template <typename List>
+static void BM_Unique(benchmark::State& state) {
+  using T = typename List::value_type;
+  const size_t n = static_cast<size_t>(state.range(0));
+  std::vector<T> values = RandomValues<T>(n, static_cast<unsigned>(n / 2 + 1));
+  std::sort(values.begin(), values.end());
+  List list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    list.clear();
+    Fill(list, values);
+    state.ResumeTiming();
+    list.unique();
+    benchmark::DoNotOptimize(list.front());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_LIST_BENCH(BM_Unique);
+
+// 10^6 отсортированных элементов, доля дубликатов 0%, 50% и 99%:
+// каждый ключ повторяется 1, 2 или 100 раз
+static std::vector<int> SortedWithDuplicates(size_t n, int percent) {
+  const size_t repeat = percent == 0 ? 1 : 100 / static_cast<size_t>(100 - percent);
+  std::vector<int> values(n);
+  for (size_t i = 0; i < n; ++i) values[i] = static_cast<int>(i / repeat);
+  return values;
+}
+
+template <typename List>
+static void BM_UniqueDuplicates(benchmark::State& state) {
+  const auto values = SortedWithDuplicates(1000000, static_cast<int>(state.range(0)));
+  List list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    list.clear();
+    Fill(list, values);
+    state.ResumeTiming();
+    list.unique();
+    benchmark::DoNotOptimize(list.front());
+  }
+  state.SetItemsProcessed(state.iterations() * 1000000);
+}
+BENCHMARK_TEMPLATE(BM_UniqueDuplicates, s21::list<int>)->Arg(0)->Arg(50)->Arg(99);
+BENCHMARK_TEMPLATE(BM_UniqueDuplicates, std::list<int>)->Arg(0)->Arg(50)->Arg(99);
+
+// удаляется та же доля элементов: ключи, не кратные повтору
+template <typename List>
+static void BM_RemoveIf(benchmark::State& state) {
+  const int percent = static_cast<int>(state.range(0));
+  const int repeat = percent == 0 ? 1 : 100 / (100 - percent);
+  const auto values = RandomValues<int>(1000000);
+  List list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    list.clear();
+    Fill(list, values);
+    state.ResumeTiming();
+    list.remove_if([repeat](int value) { return static_cast<unsigned>(value) % static_cast<unsigned>(repeat) != 0; });
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * 1000000);
+}
+BENCHMARK_TEMPLATE(BM_RemoveIf, s21::list<int>)->Arg(0)->Arg(50)->Arg(99);
+BENCHMARK_TEMPLATE(BM_RemoveIf, std::list<int>)->Arg(0)->Arg(50)->Arg(99);
+
+// два отсортированных списка по N/2 элементов
+template <typename List>
+static void BM_Merge(benchmark::State& state) {
+  using T = typename List::value_type;
+  const size_t n = static_cast<size_t>(state.range(0));
+  std::vector<T> left = RandomValues<T>(n / 2);
+  std::vector<T> right = RandomValues<T>(n - n / 2);
+  std::reverse(right.begin(), right.end());
+  std::sort(left.begin(), left.end());
+  std::sort(right.begin(), right.end());
+  List first;
+  List second;
+  for (auto _ : state) {
+    state.PauseTiming();
+    first.clear();
+    Fill(first, left);
+    Fill(second, right);
+    state.ResumeTiming();
+    first.merge(second);
+    benchmark::DoNotOptimize(first.front());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_LIST_BENCH(BM_Merge);
+
+// ------------------------------ splice / reverse ------------------------------
+
+// весь список переезжает туда и обратно — стоимость не зависит от N
+template <typename List>
+static void BM_Splice(benchmark::State& state) {
+  using T = typename List::value_type;
+  List first;
+  List second;
+  Fill(first, RandomValues<T>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    second.splice(second.begin(), first);
+    first.splice(first.end(), second);
+    benchmark::DoNotOptimize(first.front());
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+S21_LIST_BENCH(BM_Splice);
+
+// планировщик: задача из головы одной очереди переезжает в хвост другой
+// и обратно. splice перевешивает узел, размер N не важен
+template <typename List>
+static void BM_SpliceOne(benchmark::State& state) {
+  using T = typename List::value_type;
+  List first;
+  List second;
+  Fill(first, RandomValues<T>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    second.splice(second.end(), first, first.begin());
+    first.splice(first.end(), second, second.begin());
+  }
+  benchmark::DoNotOptimize(first.front());
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+S21_LIST_BENCH(BM_SpliceOne);
+
+// то же без splice: копия значения, освобождение и выделение узла
+template <typename List>
+static void BM_MoveOneEraseInsert(benchmark::State& state) {
+  using T = typename List::value_type;
+  List first;
+  List second;
+  Fill(first, RandomValues<T>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    second.push_back(first.front());
+    first.erase(first.begin());
+    first.push_back(second.front());
+    second.erase(second.begin());
+  }
+  benchmark::DoNotOptimize(first.front());
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_TEMPLATE(BM_MoveOneEraseInsert, s21::list<int>)->Apply(s21_bench::SizeRange<int>);
+BENCHMARK_TEMPLATE(BM_MoveOneEraseInsert, s21::list<Payload1K>)->Apply(s21_bench::SizeRange<Payload1K>);
+
+// первая половина списка (N/2 узлов) переезжает в другой список и
+// возвращается в хвост. Без известного числа узлов splice пересчитывает
+// диапазон — O(N), с ним — O(1). Граница половины — узел, с которого
+// начинался прошлый переезд, поэтому искать её не нужно
+template <typename List>
+static void BM_SpliceRangeCounted(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  List first;
+  List second;
+  Fill(first, RandomValues<int>(n));
+  auto middle = std::next(first.begin(), static_cast<long>(n / 2));
+  for (auto _ : state) {
+    second.splice(second.end(), first, first.begin(), middle);
+    middle = second.begin();
+    first.splice(first.end(), second, second.begin(), second.end());
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_TEMPLATE(BM_SpliceRangeCounted, s21::list<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SpliceRangeCounted, std::list<int>)->Range(1 << 10, 1 << 20);
+
+static void BM_SpliceRangeSized(benchmark::State& state) {
+  const size_t n = static_cast<size_t>(state.range(0));
+  s21::list<int> first;
+  s21::list<int> second;
+  Fill(first, RandomValues<int>(n));
+  auto middle = std::next(first.begin(), static_cast<long>(n / 2));
+  for (auto _ : state) {
+    second.splice(second.end(), first, first.begin(), middle, n / 2);
+    middle = second.begin();
+    first.splice(first.end(), second, second.begin(), second.end(), n / 2);
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_SpliceRangeSized)->Range(1 << 10, 1 << 20);
+
+template <typename List>
+static void BM_Reverse(benchmark::State& state) {
+  using T = typename List::value_type;
+  List list;
+  Fill(list, RandomValues<T>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    list.reverse();
+    benchmark::DoNotOptimize(list.front());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_LIST_BENCH(BM_Reverse);
+
+// -------------------------- копирование и перемещение --------------------------
+
+template <typename List>
+static void BM_CopyConstruct(benchmark::State& state) {
+  using T = typename List::value_type;
+  List list;
+  Fill(list, RandomValues<T>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    List copy(list);
+    benchmark::DoNotOptimize(copy.front());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_LIST_BENCH(BM_CopyConstruct);
+
+// присваивание копии в список, где уже было range(1) процентов от n
+// элементов: s21::list перезаписывает имеющиеся узлы на месте
+template <typename List>
+static void BM_CopyAssign(benchmark::State& state) {
+  using T = typename List::value_type;
+  const size_t n = static_cast<size_t>(state.range(0));
+  List list;
+  Fill(list, RandomValues<T>(n));
+  const size_t kept = n * static_cast<size_t>(state.range(1)) / 100;
+  for (auto _ : state) {
+    state.PauseTiming();
+    List target;
+    Fill(target, RandomValues<T>(kept));
+    state.ResumeTiming();
+    target = list;
+    benchmark::DoNotOptimize(target.size());
+    state.PauseTiming();
+    target.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_COPY_BENCH(func, List)                                 \
+  BENCHMARK_TEMPLATE(func, List)->Args({1000000, 0})->Args({1000000, 100}) \
+      ->Unit(benchmark::kMillisecond)
+
+S21_COPY_BENCH(BM_CopyAssign, s21::list<int>);
+S21_COPY_BENCH(BM_CopyAssign, std::list<int>);
+S21_COPY_BENCH(BM_CopyAssign, s21::list<std::string>);
+S21_COPY_BENCH(BM_CopyAssign, std::list<std::string>);
+
+template <typename List>
+static void BM_MoveConstruct(benchmark::State& state) {
+  using T = typename List::value_type;
+  List list;
+  Fill(list, RandomValues<T>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    List moved(std::move(list));
+    list = std::move(moved);
+    benchmark::DoNotOptimize(list.front());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+S21_LIST_BENCH(BM_MoveConstruct);
+
+// ---------------------------------- merge_all ----------------------------------
+// 2^20 элементов разложены по k отсортированным спискам; merge_all сливает их
+// сбалансированным деревом, для сравнения — последовательные попарные merge
+
+static void FillShards(std::vector<s21::list<int>>& shards, int total) {
+  for (int i = 0; i < total; ++i)
+    shards[static_cast<size_t>(i) % shards.size()].push_back(i);
+}
+
+static void BM_MergeAll(benchmark::State& state) {
+  const int total = 1 << 20;
+  std::vector<s21::list<int>> shards(static_cast<size_t>(state.range(0)));
+  s21::list<int> result;
+  for (auto _ : state) {
+    state.PauseTiming();
+    result.clear();
+    FillShards(shards, total);
+    state.ResumeTiming();
+    result.merge_all(shards.begin(), shards.end());
+    benchmark::DoNotOptimize(result.front());
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+
+static void BM_MergePairwise(benchmark::State& state) {
+  const int total = 1 << 20;
+  std::vector<s21::list<int>> shards(static_cast<size_t>(state.range(0)));
+  s21::list<int> result;
+  for (auto _ : state) {
+    state.PauseTiming();
+    result.clear();
+    FillShards(shards, total);
+    state.ResumeTiming();
+    for (auto& shard : shards) result.merge(shard);
+    benchmark::DoNotOptimize(result.front());
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+
+BENCHMARK(BM_MergeAll)->RangeMultiplier(4)->Range(2, 512);
+BENCHMARK(BM_MergePairwise)->RangeMultiplier(4)->Range(2, 512);
+
+// ---------------------------- массовое построение ----------------------------
+// список на 10^5 элементов строится заново на каждый запрос: диапазонным
+// конструктором, push_back по одному, assign поверх старого или
+// clear + push_back
+
+template <typename List>
+static void BM_BuildFromRange(benchmark::State& state) {
+  using T = typename List::value_type;
+  const auto values = RandomValues<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    List list(values.begin(), values.end());
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+static void BM_BuildPushBack(benchmark::State& state) {
+  using T = typename List::value_type;
+  const auto values = RandomValues<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    List list;
+    for (const T& value : values) list.push_back(value);
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+static void BM_RebuildAssign(benchmark::State& state) {
+  using T = typename List::value_type;
+  const auto values = RandomValues<T>(static_cast<size_t>(state.range(0)));
+  List list(values.begin(), values.end());
+  for (auto _ : state) {
+    list.assign(values.begin(), values.end());
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+static void BM_RebuildClearPushBack(benchmark::State& state) {
+  using T = typename List::value_type;
+  const auto values = RandomValues<T>(static_cast<size_t>(state.range(0)));
+  List list(values.begin(), values.end());
+  for (auto _ : state) {
+    list.clear();
+    for (const T& value : values) list.push_back(value);
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_BUILD_BENCH(func)                                              \
+  BENCHMARK_TEMPLATE(func, s21::list<int>)->Arg(100000);                    \
+  BENCHMARK_TEMPLATE(func, std::list<int>)->Arg(100000);                    \
+  BENCHMARK_TEMPLATE(func, s21::list<std::string>)->Arg(100000);            \
+  BENCHMARK_TEMPLATE(func, std::list<std::string>)->Arg(100000)
+
+S21_BUILD_BENCH(BM_BuildFromRange);
+S21_BUILD_BENCH(BM_BuildPushBack);
+S21_BUILD_BENCH(BM_RebuildAssign);
+S21_BUILD_BENCH(BM_RebuildClearPushBack);
+
+// ------------------------------- аллокаторы -------------------------------
+// сравнение std::allocator и pool_allocator на заполнении/очистке, очереди
+// push_back + pop_front и обходе списка
+
+using PooledList = s21::list<int, s21::pool_allocator<int>>;
+
+template <typename List>
+static void BM_AllocPushBackClear(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  List list;
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) list.push_back(i);
+    list.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename List>
+static void BM_AllocQueueChurn(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  List list;
+  for (int i = 0; i < n; ++i) list.push_back(i);
+  for (auto _ : state) {
+    list.push_back(1);
+    list.pop_front();
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+// список строится вперемешку с чужими выделениями памяти, чтобы узлы
+// обычного аллокатора оказались разбросаны по куче
+template <typename List>
+static void BM_AllocIterate(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  List list;
+  std::vector<std::unique_ptr<char[]>> noise;
+  for (int i = 0; i < n; ++i) {
+    list.push_back(i);
+    noise.emplace_back(new char[24 + (i % 7) * 8]);
+  }
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(BM_AllocPushBackClear, s21::list<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AllocPushBackClear, PooledList)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AllocQueueChurn, s21::list<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AllocQueueChurn, PooledList)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AllocIterate, s21::list<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AllocIterate, PooledList)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../containers/execution.h"
+#include "../containers/list.h"
+#include "../containers/thread_pool.h"
+#include "../containers/vector.h"
+#include "bench_common.h"
+
+using s21_bench::Fill;
+using s21_bench::RandomValues;
+
+// масштабирование sort(par) по числу потоков пула: range(0) — размер,
+// range(1) — concurrency пула (1 — то же, что последовательная сортировка).
+// Пул создаётся вне замера; реальный прирост ограничен числом ядер машины
+
+namespace {
+
+void ThreadArgs(benchmark::internal::Benchmark* bench) {
+  for (long threads = 1; threads <= 64; threads *= 2) bench->Args({1 << 22, threads});
+  bench->ArgNames({"n", "threads"})->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+}  // namespace
+
+template <typename T>
+static void BM_ParallelSortList(benchmark::State& state) {
+  const std::vector<T> values = RandomValues<T>(static_cast<size_t>(state.range(0)));
+  s21::thread_pool pool(static_cast<size_t>(state.range(1)));
+  s21::list<T> list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    list.clear();
+    Fill(list, values);
+    state.ResumeTiming();
+    list.sort(s21::execution::par.on(pool), std::less<T>());
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ParallelSortList, int)->Apply(ThreadArgs);
+BENCHMARK_TEMPLATE(BM_ParallelSortList, std::string)->Apply(ThreadArgs);
+
+template <typename T>
+static void BM_ParallelSortVector(benchmark::State& state) {
+  const std::vector<T> values = RandomValues<T>(static_cast<size_t>(state.range(0)));
+  s21::thread_pool pool(static_cast<size_t>(state.range(1)));
+  s21::vector<T> vector;
+  for (auto _ : state) {
+    state.PauseTiming();
+    vector.clear();
+    Fill(vector, values);
+    state.ResumeTiming();
+    vector.sort(s21::execution::par.on(pool), std::less<T>());
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ParallelSortVector, int)->Apply(ThreadArgs);
+BENCHMARK_TEMPLATE(BM_ParallelSortVector, std::string)->Apply(ThreadArgs);
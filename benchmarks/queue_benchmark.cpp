@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <queue>
+#include <stack>
+#include <string>
+
+#include "../containers/list.h"
+#include "../containers/queue.h"
+#include "../containers/stack.h"
+#include "bench_common.h"
+
+// Адаптеры queue и stack: кольцевой буфер по умолчанию, s21::list как
+// подключаемый контейнер и std::queue/std::stack поверх std::deque.
+
+namespace {
+
+using ListQueue = s21::queue<int, s21::list<int>>;
+
+void QueueSizes(benchmark::internal::Benchmark* bench) {
+  for (long long n : {16, 1024, 1 << 20}) bench->Arg(n);
+}
+
+}  // namespace
+
+// n push, затем n pop: заполнение с нуля и полный слив
+template <typename Queue>
+static void BM_QueueFillDrain(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Queue queue;
+    for (int i = 0; i < n; ++i) queue.push(i);
+    long long sum = 0;
+    while (!queue.empty()) {
+      sum += queue.front();
+      queue.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK_TEMPLATE(BM_QueueFillDrain, s21::queue<int>)->Apply(QueueSizes);
+BENCHMARK_TEMPLATE(BM_QueueFillDrain, ListQueue)->Apply(QueueSizes);
+BENCHMARK_TEMPLATE(BM_QueueFillDrain, std::queue<int>)->Apply(QueueSizes);
+
+// конвейер постоянной глубины n: каждая итерация — один push и один pop,
+// голова и хвост всё время бегут по кругу
+template <typename Queue>
+static void BM_QueueSteadyState(benchmark::State& state) {
+  using T = typename Queue::value_type;
+  const int n = static_cast<int>(state.range(0));
+  const T value = s21_bench::MakeValue<T>(7);
+  Queue queue;
+  for (int i = 0; i < n; ++i) queue.push(value);
+  for (auto _ : state) {
+    queue.push(value);
+    benchmark::DoNotOptimize(queue.front());
+    queue.pop();
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::queue<int>)->Apply(QueueSizes);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, ListQueue)->Apply(QueueSizes);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, std::queue<int>)->Apply(QueueSizes);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, s21::queue<std::string>)->Apply(QueueSizes);
+BENCHMARK_TEMPLATE(BM_QueueSteadyState, std::queue<std::string>)->Apply(QueueSizes);
+
+template <typename Stack>
+static void BM_StackPushPop(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Stack stack;
+    for (int i = 0; i < n; ++i) stack.push(i);
+    long long sum = 0;
+    while (!stack.empty()) {
+      sum += stack.top();
+      stack.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK_TEMPLATE(BM_StackPushPop, s21::stack<int>)->Apply(QueueSizes);
+BENCHMARK_TEMPLATE(BM_StackPushPop, std::stack<int>)->Apply(QueueSizes);
@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "../containers/simd.h"
+#include "../containers/vector.h"
+#include "bench_common.h"
+
+// ядра simd.h против обычных алгоритмов std на том же s21::vector.
+// Второй параметр шаблона: true — simd_*, false — std. items_per_second —
+// пропускная способность на элемент; искомого значения в данных нет,
+// так что find и equal проходят весь диапазон
+
+namespace {
+
+template <typename T>
+s21::vector<T> Values(std::size_t n) {
+  s21::vector<T> values;
+  values.reserve(n);
+  for (int value : s21_bench::RandomValues<int>(n)) values.push_back(static_cast<T>(value % 100000 + 1));
+  return values;
+}
+
+void SimdSizes(benchmark::internal::Benchmark* bench) {
+  bench->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+}
+
+}  // namespace
+
+template <typename T, bool Simd>
+static void BM_SimdFind(benchmark::State& state) {
+  const auto values = Values<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    const T* found = Simd ? s21::simd_find(values.begin(), values.end(), T(0))
+                          : std::find(values.begin(), values.end(), T(0));
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T, bool Simd>
+static void BM_SimdCount(benchmark::State& state) {
+  const auto values = Values<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::size_t count = Simd ? s21::simd_count(values.begin(), values.end(), T(7))
+                             : static_cast<std::size_t>(std::count(values.begin(), values.end(), T(7)));
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T, bool Simd>
+static void BM_SimdSum(benchmark::State& state) {
+  const auto values = Values<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    T sum = Simd ? s21::simd_sum(values.begin(), values.end()) : std::accumulate(values.begin(), values.end(), T(0));
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T, bool Simd>
+static void BM_SimdMinMax(benchmark::State& state) {
+  const auto values = Values<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    if (Simd) {
+      benchmark::DoNotOptimize(s21::simd_minmax(values.begin(), values.end()));
+    } else {
+      auto bounds = std::minmax_element(values.begin(), values.end());
+      benchmark::DoNotOptimize(bounds);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T, bool Simd>
+static void BM_SimdEqual(benchmark::State& state) {
+  const auto values = Values<T>(static_cast<std::size_t>(state.range(0)));
+  const auto copy = values;
+  for (auto _ : state) {
+    bool equal = Simd ? s21::simd_equal(values.begin(), values.end(), copy.begin())
+                      : std::equal(values.begin(), values.end(), copy.begin());
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T, bool Simd>
+static void BM_SimdFill(benchmark::State& state) {
+  auto values = Values<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    if (Simd)
+      s21::simd_fill(values.begin(), values.end(), T(3));
+    else
+      std::fill(values.begin(), values.end(), T(3));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_SIMD_BENCH(func)                                               \
+  BENCHMARK_TEMPLATE(func, std::int32_t, true)->Apply(SimdSizes);          \
+  BENCHMARK_TEMPLATE(func, std::int32_t, false)->Apply(SimdSizes);         \
+  BENCHMARK_TEMPLATE(func, std::int64_t, true)->Apply(SimdSizes);          \
+  BENCHMARK_TEMPLATE(func, std::int64_t, false)->Apply(SimdSizes);         \
+  BENCHMARK_TEMPLATE(func, float, true)->Apply(SimdSizes);                 \
+  BENCHMARK_TEMPLATE(func, float, false)->Apply(SimdSizes)
+
+S21_SIMD_BENCH(BM_SimdFind);
+S21_SIMD_BENCH(BM_SimdCount);
+S21_SIMD_BENCH(BM_SimdSum);
+S21_SIMD_BENCH(BM_SimdMinMax);
+S21_SIMD_BENCH(BM_SimdEqual);
+S21_SIMD_BENCH(BM_SimdFill);
@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../containers/list.h"
+#include "../containers/small_vector.h"
+#include "../containers/vector.h"
+#include "bench_common.h"
+
+using s21_bench::RandomValues;
+using s21_bench::Touch;
+
+// короткоживущие контейнеры на 1..64 элемента: s21::small_vector<T, 8>
+// против s21::vector и s21::list. allocs_per_op — сколько раз контейнер
+// обратился к аллокатору за одно построение (без кучи самих строк)
+
+namespace {
+
+inline std::size_t allocationCount = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    ++allocationCount;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* pointer, std::size_t n) noexcept { std::allocator<T>().deallocate(pointer, n); }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>&) const noexcept { return false; }
+};
+
+template <typename T>
+using CountedSmall = s21::small_vector<T, 8, CountingAllocator<T>>;
+template <typename T>
+using CountedVector = s21::vector<T, CountingAllocator<T>>;
+template <typename T>
+using CountedList = s21::list<T, CountingAllocator<T>>;
+
+void SmallSizes(benchmark::internal::Benchmark* bench) {
+  for (long n = 1; n <= 64; n *= 2) bench->Arg(n);
+}
+
+}  // namespace
+
+// построить, один раз обойти и уничтожить — жизнь списка на один запрос
+template <typename Container>
+static void BM_SmallBuildAndWalk(benchmark::State& state) {
+  using T = typename Container::value_type;
+  const auto values = RandomValues<T>(static_cast<std::size_t>(state.range(0)));
+  const std::size_t before = allocationCount;
+  for (auto _ : state) {
+    Container container;
+    for (const T& value : values) container.push_back(value);
+    long long sum = 0;
+    for (const T& value : container) sum += Touch(value);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.counters["allocs_per_op"] =
+      static_cast<double>(allocationCount - before) / static_cast<double>(state.iterations());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// перемещение готового контейнера, например в очередь обработчиков
+template <typename Container>
+static void BM_SmallMove(benchmark::State& state) {
+  using T = typename Container::value_type;
+  Container source;
+  for (const T& value : RandomValues<T>(static_cast<std::size_t>(state.range(0)))) source.push_back(value);
+  for (auto _ : state) {
+    Container moved(std::move(source));
+    benchmark::DoNotOptimize(moved.begin());
+    source = std::move(moved);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+#define S21_SMALL_BENCH(func, T)                                  \
+  BENCHMARK_TEMPLATE(func, CountedSmall<T>)->Apply(SmallSizes);  \
+  BENCHMARK_TEMPLATE(func, CountedVector<T>)->Apply(SmallSizes); \
+  BENCHMARK_TEMPLATE(func, CountedList<T>)->Apply(SmallSizes)
+
+S21_SMALL_BENCH(BM_SmallBuildAndWalk, int);
+S21_SMALL_BENCH(BM_SmallBuildAndWalk, std::string);
+// перемещение не выделяет память, поэтому здесь аллокатор обычный
+#define S21_SMALL_MOVE_BENCH(T)                                              \
+  BENCHMARK_TEMPLATE(BM_SmallMove, s21::small_vector<T, 8>)->Apply(SmallSizes); \
+  BENCHMARK_TEMPLATE(BM_SmallMove, s21::vector<T>)->Apply(SmallSizes);          \
+  BENCHMARK_TEMPLATE(BM_SmallMove, s21::list<T>)->Apply(SmallSizes)
+
+S21_SMALL_MOVE_BENCH(int);
+S21_SMALL_MOVE_BENCH(std::string);
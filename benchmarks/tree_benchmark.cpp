@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../containers/map.h"
+#include "../containers/multiset.h"
+#include "../containers/set.h"
+#include "bench_common.h"
+
+using s21_bench::RandomValues;
+
+// map/set/multiset на красно-чёрном дереве рядом с std на случайных int
+// ключах до 10^6. Вариант s21::map с std::allocator показывает, сколько
+// даёт пул узлов. Перестройка контейнера идёт вне замера.
+
+using HeapMap = s21::map<int, int, std::less<int>, std::allocator<std::pair<const int, int>>>;
+
+#define S21_TREE_BENCH(func)                                                   \
+  BENCHMARK_TEMPLATE(func, s21::map<int, int>)->Apply(TreeSizes);              \
+  BENCHMARK_TEMPLATE(func, HeapMap)->Apply(TreeSizes);                         \
+  BENCHMARK_TEMPLATE(func, std::map<int, int>)->Apply(TreeSizes);              \
+  BENCHMARK_TEMPLATE(func, s21::set<int>)->Apply(TreeSizes);                   \
+  BENCHMARK_TEMPLATE(func, std::set<int>)->Apply(TreeSizes);                   \
+  BENCHMARK_TEMPLATE(func, s21::multiset<int>)->Apply(TreeSizes);              \
+  BENCHMARK_TEMPLATE(func, std::multiset<int>)->Apply(TreeSizes)
+
+static void TreeSizes(benchmark::internal::Benchmark* bench) {
+  for (long long n = 1000; n <= 1000000; n *= 10) bench->Arg(n);
+}
+
+// у словарей значение — пара, у множеств — сам ключ
+template <typename Key, typename T, typename Compare, typename Allocator>
+static void Insert(s21::map<Key, T, Compare, Allocator>& map, int key) {
+  map.insert({key, key});
+}
+
+template <typename Key, typename T>
+static void Insert(std::map<Key, T>& map, int key) {
+  map.insert({key, key});
+}
+
+template <typename Set>
+static void Insert(Set& set, int key) {
+  set.insert(key);
+}
+
+template <typename Tree>
+static void FillTree(Tree& tree, const std::vector<int>& keys) {
+  for (int key : keys) Insert(tree, key);
+}
+
+// те же ключи в другом случайном порядке — для поиска и удаления
+static std::vector<int> Shuffled(std::vector<int> keys) {
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+  return keys;
+}
+
+template <typename Tree>
+static void BM_TreeInsert(benchmark::State& state) {
+  const std::vector<int> keys = RandomValues<int>(static_cast<size_t>(state.range(0)));
+  Tree tree;
+  for (auto _ : state) {
+    FillTree(tree, keys);
+    state.PauseTiming();
+    tree.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_TREE_BENCH(BM_TreeInsert);
+
+template <typename Tree>
+static void BM_TreeFind(benchmark::State& state) {
+  const std::vector<int> keys = RandomValues<int>(static_cast<size_t>(state.range(0)));
+  const std::vector<int> lookups = Shuffled(keys);
+  Tree tree;
+  FillTree(tree, keys);
+  for (auto _ : state) {
+    size_t found = 0;
+    for (int key : lookups) found += tree.find(key) != tree.end();
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_TREE_BENCH(BM_TreeFind);
+
+template <typename Tree>
+static void BM_TreeErase(benchmark::State& state) {
+  const std::vector<int> keys = RandomValues<int>(static_cast<size_t>(state.range(0)));
+  const std::vector<int> order = Shuffled(keys);
+  Tree tree;
+  for (auto _ : state) {
+    state.PauseTiming();
+    FillTree(tree, keys);
+    state.ResumeTiming();
+    for (int key : order) tree.erase(key);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_TREE_BENCH(BM_TreeErase);
+
+template <typename Tree>
+static void BM_TreeIterate(benchmark::State& state) {
+  Tree tree;
+  FillTree(tree, RandomValues<int>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    size_t visited = 0;
+    for (auto it = tree.begin(); it != tree.end(); ++it) ++visited;
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_TREE_BENCH(BM_TreeIterate);
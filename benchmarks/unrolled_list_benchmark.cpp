@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../containers/list.h"
+#include "../containers/unrolled_list.h"
+#include "bench_common.h"
+
+using s21_bench::Fill;
+using s21_bench::MakeValue;
+using s21_bench::Payload256;
+using s21_bench::RandomValues;
+using s21_bench::Touch;
+
+// s21::unrolled_list против s21::list: сколько памяти уходит на элемент
+// (bytes_per_element — всё, что взято у аллокатора, делённое на размер)
+// и скорость обхода, когда узлы списка разбросаны по куче.
+
+namespace {
+
+// считает байты, выданные всеми копиями аллокатора (в том числе rebind)
+inline std::size_t allocatedBytes = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    allocatedBytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* pointer, std::size_t n) noexcept {
+    allocatedBytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(pointer, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>&) const noexcept { return false; }
+};
+
+template <typename T>
+using CountedList = s21::list<T, CountingAllocator<T>>;
+template <typename T>
+using CountedUnrolled = s21::unrolled_list<T, s21::kUnrolledDefaultCount<T>, CountingAllocator<T>>;
+
+}  // namespace
+
+#define S21_UNROLLED_BENCH(func, T)                                            \
+  BENCHMARK_TEMPLATE(func, CountedUnrolled<T>)->Apply(s21_bench::SizeRange<T>); \
+  BENCHMARK_TEMPLATE(func, CountedList<T>)->Apply(s21_bench::SizeRange<T>)
+
+#define S21_UNROLLED_BENCH_ALL(func)   \
+  S21_UNROLLED_BENCH(func, int);         \
+  S21_UNROLLED_BENCH(func, std::string); \
+  S21_UNROLLED_BENCH(func, Payload256)
+
+// заполнение push_back; память без учёта кучи самих строк
+template <typename List>
+static void BM_UnrolledFootprint(benchmark::State& state) {
+  using T = typename List::value_type;
+  const auto values = RandomValues<T>(static_cast<size_t>(state.range(0)));
+  std::size_t bytes = 0;
+  for (auto _ : state) {
+    const std::size_t before = allocatedBytes;
+    List list;
+    Fill(list, values);
+    bytes = allocatedBytes - before;
+    benchmark::ClobberMemory();
+  }
+  state.counters["bytes_per_element"] = static_cast<double>(bytes) / static_cast<double>(state.range(0));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_UNROLLED_BENCH_ALL(BM_UnrolledFootprint);
+
+// список строится вперемешку с чужими выделениями, как в BM_AllocIterate
+template <typename List>
+static void BM_UnrolledTraverse(benchmark::State& state) {
+  using T = typename List::value_type;
+  const size_t n = static_cast<size_t>(state.range(0));
+  const auto values = RandomValues<T>(n);
+  List list;
+  std::vector<std::unique_ptr<char[]>> noise;
+  for (size_t i = 0; i < n; ++i) {
+    list.push_back(values[i]);
+    noise.emplace_back(new char[24 + (i % 7) * 8]);
+  }
+  for (auto _ : state) {
+    long long sum = 0;
+    for (const T& value : list) sum += Touch(value);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_UNROLLED_BENCH_ALL(BM_UnrolledTraverse);
+
+// проход до середины, вставка и удаление там: у unrolled_list это сдвиг
+// внутри блока, у list — перевязка узла
+template <typename List>
+static void BM_UnrolledInsertEraseMiddle(benchmark::State& state) {
+  using T = typename List::value_type;
+  const size_t n = static_cast<size_t>(state.range(0));
+  const T value = MakeValue<T>(1);
+  List list;
+  Fill(list, RandomValues<T>(n));
+  for (auto _ : state) {
+    auto middle = list.begin();
+    for (size_t i = 0; i < n / 2; ++i) ++middle;
+    auto inserted = list.insert(middle, value);
+    list.erase(inserted);
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+S21_UNROLLED_BENCH_ALL(BM_UnrolledInsertEraseMiddle);
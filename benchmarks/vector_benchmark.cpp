@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "../containers/vector.h"
+#include "bench_common.h"
+
+using s21_bench::Fill;
+using s21_bench::MakeValue;
+using s21_bench::Payload1K;
+using s21_bench::Payload256;
+using s21_bench::RandomValues;
+using s21_bench::Touch;
+
+// s21::vector рядом с std::vector: рост через push_back, обход и пакетная
+// вставка (insert_many против insert из initializer_list)
+
+#define S21_VECTOR_BENCH(func)                                                \
+  S21_BENCH_PAIR(func, s21::vector<int>, std::vector<int>, int);              \
+  S21_BENCH_PAIR(func, s21::vector<std::string>, std::vector<std::string>,    \
+                 std::string);                                                \
+  S21_BENCH_PAIR(func, s21::vector<Payload256>, std::vector<Payload256>,      \
+                 Payload256);                                                 \
+  S21_BENCH_PAIR(func, s21::vector<Payload1K>, std::vector<Payload1K>,        \
+                 Payload1K)
+
+// без reserve: меряется геометрический рост и перенос элементов
+template <typename Vector>
+static void BM_VectorPushBack(benchmark::State& state) {
+  using T = typename Vector::value_type;
+  const size_t n = static_cast<size_t>(state.range(0));
+  const T value = MakeValue<T>(1);
+  for (auto _ : state) {
+    Vector vector;
+    for (size_t i = 0; i < n; ++i) vector.push_back(value);
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_VECTOR_BENCH(BM_VectorPushBack);
+
+template <typename Vector>
+static void BM_VectorIterate(benchmark::State& state) {
+  using T = typename Vector::value_type;
+  Vector vector;
+  Fill(vector, RandomValues<T>(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = vector.begin(); it != vector.end(); ++it) sum += Touch(*it);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+S21_VECTOR_BENCH(BM_VectorIterate);
+
+// восемь элементов за раз в середину вектора длины N
+template <typename T>
+static void BulkInsert(s21::vector<T>& vector, const T& value) {
+  vector.insert_many(vector.begin() + vector.size() / 2, value, value, value,
+                     value, value, value, value, value);
+}
+
+template <typename T>
+static void BulkInsert(std::vector<T>& vector, const T& value) {
+  vector.insert(vector.begin() + static_cast<long>(vector.size() / 2),
+                {value, value, value, value, value, value, value, value});
+}
+
+template <typename Vector>
+static void BM_VectorBulkInsertMiddle(benchmark::State& state) {
+  using T = typename Vector::value_type;
+  const std::vector<T> values = RandomValues<T>(static_cast<size_t>(state.range(0)));
+  const T value = MakeValue<T>(7);
+  Vector vector;
+  for (auto _ : state) {
+    state.PauseTiming();
+    vector.clear();
+    Fill(vector, values);
+    state.ResumeTiming();
+    BulkInsert(vector, value);
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 8);
+}
+S21_VECTOR_BENCH(BM_VectorBulkInsertMiddle);
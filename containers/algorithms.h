@@ -0,0 +1,280 @@
+#ifndef S21_CONTAINERS_ALGORITHMS_H
+#define S21_CONTAINERS_ALGORITHMS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "execution.h"
+
+namespace s21 {
+
+// Алгоритмы над итераторами контейнеров библиотеки с политикой выполнения
+// первым аргументом, как в std. seq вызывает алгоритм std в текущем
+// потоке. par и par_unseq делят диапазон на куски и раздают их пулу
+// политики: contiguous-диапазоны (итераторы произвольного доступа) — по
+// индексам, связные списки — заранее, одним проходом по узлам, отмечая
+// границу каждые kParallelGrain элементов. Функции и предикаты вызываются
+// из разных потоков одновременно и не должны менять общие данные без
+// синхронизации. Выходной диапазон transform и copy_if должен быть
+// однонаправленным (forward) итератором.
+
+// кусок меньше этого не окупает передачу в другой поток
+constexpr std::size_t kParallelGrain = std::size_t(1) << 14;
+// кусков на поток у contiguous-диапазонов: запас для балансировки воровством
+constexpr std::size_t kParallelChunksPerThread = 4;
+
+// куски [bounds[i], bounds[i + 1]); offsets[i] — номер первого элемента
+// куска от начала диапазона, offsets.back() — длина диапазона
+template <typename It>
+struct ParallelChunks {
+    std::vector<It> bounds;
+    std::vector<std::size_t> offsets;
+
+    std::size_t count() const noexcept { return bounds.size() - 1; }
+};
+
+template <typename It>
+constexpr bool isRandomAccessIterator =
+    std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value;
+
+template <typename Policy>
+constexpr bool isSequencedPolicy =
+    std::is_same<typename std::decay<Policy>::type, execution::sequenced_policy>::value;
+
+// пустой диапазон даёт ноль кусков, остальные куски непустые
+template <typename It>
+ParallelChunks<It> splitForParallel(It first, It last, std::size_t concurrency) {
+    ParallelChunks<It> chunks;
+    chunks.bounds.push_back(first);
+    chunks.offsets.push_back(0);
+    if constexpr (isRandomAccessIterator<It>) {
+        const std::size_t n = static_cast<std::size_t>(last - first);
+        if (n == 0)
+            return chunks;
+        const std::size_t count =
+            std::max<std::size_t>(std::min(concurrency * kParallelChunksPerThread, n / kParallelGrain), 1);
+        for (std::size_t i = 1; i <= count; ++i) {
+            chunks.offsets.push_back(n * i / count);
+            chunks.bounds.push_back(first + static_cast<std::ptrdiff_t>(chunks.offsets.back()));
+        }
+    } else {
+        // длина заранее неизвестна, поэтому режется куском фиксированной длины
+        std::size_t offset = 0;
+        while (first != last) {
+            for (std::size_t i = 0; i < kParallelGrain && first != last; ++i, ++offset)
+                ++first;
+            chunks.bounds.push_back(first);
+            chunks.offsets.push_back(offset);
+        }
+    }
+    return chunks;
+}
+
+// итераторы выходного диапазона на заданных смещениях от out
+template <typename OutIt>
+std::vector<OutIt> advanceToOffsets(OutIt out, const std::vector<std::size_t>& offsets) {
+    std::vector<OutIt> result;
+    result.reserve(offsets.size());
+    std::size_t at = 0;
+    for (std::size_t offset : offsets) {
+        if constexpr (isRandomAccessIterator<OutIt>) {
+            result.push_back(out + static_cast<std::ptrdiff_t>(offset));
+        } else {
+            for (; at < offset; ++at)
+                ++out;
+            result.push_back(out);
+        }
+    }
+    return result;
+}
+
+// -------------------------------------- for_each --------------------------------------
+
+template <typename ExecutionPolicy, typename ForwardIt, typename UnaryFunction,
+          typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+void for_each(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, UnaryFunction f) {
+    if constexpr (isSequencedPolicy<ExecutionPolicy>) {
+        std::for_each(first, last, f);
+    } else {
+        thread_pool& pool = policy.pool();
+        if (pool.concurrency() == 1) {
+            std::for_each(first, last, f);
+            return;
+        }
+        const auto chunks = splitForParallel(first, last, pool.concurrency());
+        pool.parallel_for(0, chunks.count(), [&chunks, &f](std::size_t i) {
+            std::for_each(chunks.bounds[i], chunks.bounds[i + 1], f);
+        });
+    }
+}
+
+// -------------------------------------- transform --------------------------------------
+
+template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2, typename UnaryOperation,
+          typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+ForwardIt2 transform(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                     UnaryOperation op) {
+    if constexpr (isSequencedPolicy<ExecutionPolicy>) {
+        return std::transform(first, last, d_first, op);
+    } else {
+        thread_pool& pool = policy.pool();
+        if (pool.concurrency() == 1)
+            return std::transform(first, last, d_first, op);
+        const auto chunks = splitForParallel(first, last, pool.concurrency());
+        const auto outputs = advanceToOffsets(d_first, chunks.offsets);
+        pool.parallel_for(0, chunks.count(), [&chunks, &outputs, &op](std::size_t i) {
+            std::transform(chunks.bounds[i], chunks.bounds[i + 1], outputs[i], op);
+        });
+        return outputs.back();
+    }
+}
+
+// --------------------------------------- reduce ---------------------------------------
+
+// op должна быть ассоциативной и коммутативной: куски сворачиваются
+// независимо, каждый начиная со своего первого элемента, а init
+// добавляется к частичным суммам в конце
+template <typename ExecutionPolicy, typename ForwardIt, typename T, typename BinaryOperation,
+          typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+T reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init, BinaryOperation op) {
+    if constexpr (isSequencedPolicy<ExecutionPolicy>) {
+        return std::reduce(first, last, init, op);
+    } else {
+        thread_pool& pool = policy.pool();
+        if (pool.concurrency() == 1)
+            return std::reduce(first, last, init, op);
+        const auto chunks = splitForParallel(first, last, pool.concurrency());
+        std::vector<std::optional<T>> partials(chunks.count());
+        pool.parallel_for(0, chunks.count(), [&chunks, &partials, &op](std::size_t i) {
+            ForwardIt begin = chunks.bounds[i];
+            T partial = *begin;
+            partials[i] = std::reduce(++begin, chunks.bounds[i + 1], std::move(partial), op);
+        });
+        for (std::optional<T>& partial : partials)
+            init = op(std::move(init), std::move(*partial));
+        return init;
+    }
+}
+
+template <typename ExecutionPolicy, typename ForwardIt, typename T,
+          typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+T reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init) {
+    return s21::reduce(std::forward<ExecutionPolicy>(policy), first, last, std::move(init), std::plus<>());
+}
+
+template <typename ExecutionPolicy, typename ForwardIt,
+          typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+typename std::iterator_traits<ForwardIt>::value_type reduce(ExecutionPolicy&& policy, ForwardIt first,
+                                                             ForwardIt last) {
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+    return s21::reduce(std::forward<ExecutionPolicy>(policy), first, last, value_type(), std::plus<>());
+}
+
+// --------------------------------------- count_if ---------------------------------------
+
+template <typename ExecutionPolicy, typename ForwardIt, typename UnaryPredicate,
+          typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+typename std::iterator_traits<ForwardIt>::difference_type count_if(ExecutionPolicy&& policy, ForwardIt first,
+                                                                   ForwardIt last, UnaryPredicate pred) {
+    using difference_type = typename std::iterator_traits<ForwardIt>::difference_type;
+    if constexpr (isSequencedPolicy<ExecutionPolicy>) {
+        return std::count_if(first, last, pred);
+    } else {
+        thread_pool& pool = policy.pool();
+        if (pool.concurrency() == 1)
+            return std::count_if(first, last, pred);
+        const auto chunks = splitForParallel(first, last, pool.concurrency());
+        std::vector<difference_type> counts(chunks.count());
+        pool.parallel_for(0, chunks.count(), [&chunks, &counts, &pred](std::size_t i) {
+            counts[i] = std::count_if(chunks.bounds[i], chunks.bounds[i + 1], pred);
+        });
+        return std::accumulate(counts.begin(), counts.end(), difference_type(0));
+    }
+}
+
+// --------------------------------------- find_if ---------------------------------------
+
+// возвращает первое совпадение во всём диапазоне: кусок, стоящий дальше
+// уже найденного, не просматривается
+template <typename ExecutionPolicy, typename ForwardIt, typename UnaryPredicate,
+          typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+ForwardIt find_if(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, UnaryPredicate pred) {
+    if constexpr (isSequencedPolicy<ExecutionPolicy>) {
+        return std::find_if(first, last, pred);
+    } else {
+        thread_pool& pool = policy.pool();
+        if (pool.concurrency() == 1)
+            return std::find_if(first, last, pred);
+        const auto chunks = splitForParallel(first, last, pool.concurrency());
+        std::vector<ForwardIt> hits(chunks.count(), last);
+        std::atomic<std::size_t> firstHit(chunks.count());
+        pool.parallel_for(0, chunks.count(), [&chunks, &hits, &firstHit, &pred](std::size_t i) {
+            std::size_t best = firstHit.load(std::memory_order_relaxed);
+            if (i > best)
+                return;
+            ForwardIt hit = std::find_if(chunks.bounds[i], chunks.bounds[i + 1], pred);
+            if (hit == chunks.bounds[i + 1])
+                return;
+            hits[i] = hit;
+            while (i < best && !firstHit.compare_exchange_weak(best, i, std::memory_order_relaxed)) {
+            }
+        });
+        // parallel_for дожидается всех задач, так что hits[firstHit] уже записан
+        const std::size_t hit = firstHit.load(std::memory_order_relaxed);
+        return hit == chunks.count() ? last : hits[hit];
+    }
+}
+
+// --------------------------------------- copy_if ---------------------------------------
+
+// два прохода: сначала каждый кусок вычисляет pred и запоминает отметки,
+// затем по префиксным суммам количеств копирует отмеченное на своё место.
+// pred вызывается ровно один раз на элемент, порядок элементов сохраняется
+template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2, typename UnaryPredicate,
+          typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+ForwardIt2 copy_if(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                   UnaryPredicate pred) {
+    if constexpr (isSequencedPolicy<ExecutionPolicy>) {
+        return std::copy_if(first, last, d_first, pred);
+    } else {
+        thread_pool& pool = policy.pool();
+        if (pool.concurrency() == 1)
+            return std::copy_if(first, last, d_first, pred);
+        const auto chunks = splitForParallel(first, last, pool.concurrency());
+        std::vector<unsigned char> selected(chunks.offsets.back());
+        std::vector<std::size_t> starts(chunks.count() + 1, 0);
+        pool.parallel_for(0, chunks.count(), [&chunks, &selected, &starts, &pred](std::size_t i) {
+            std::size_t at = chunks.offsets[i];
+            std::size_t count = 0;
+            for (ForwardIt1 it = chunks.bounds[i]; it != chunks.bounds[i + 1]; ++it, ++at) {
+                selected[at] = pred(*it) ? 1 : 0;
+                count += selected[at];
+            }
+            starts[i + 1] = count;
+        });
+        std::partial_sum(starts.begin(), starts.end(), starts.begin());
+        const auto outputs = advanceToOffsets(d_first, starts);
+        pool.parallel_for(0, chunks.count(), [&chunks, &selected, &outputs](std::size_t i) {
+            std::size_t at = chunks.offsets[i];
+            ForwardIt2 out = outputs[i];
+            for (ForwardIt1 it = chunks.bounds[i]; it != chunks.bounds[i + 1]; ++it, ++at) {
+                if (selected[at]) {
+                    *out = *it;
+                    ++out;
+                }
+            }
+        });
+        return outputs.back();
+    }
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_ALGORITHMS_H
@@ -0,0 +1,219 @@
+#ifndef S21_CONTAINERS_ARRAY_H
+#define S21_CONTAINERS_ARRAY_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "simd.h"
+
+namespace s21 {
+
+// Массив фиксированного размера N. Это агрегат, как std::array: создаётся
+// списком инициализации array<int, 3> a = {1, 2, 3}, копируется и
+// перемещается неявно. Всё, кроме at() с выходом за границу, работает в
+// constexpr, поэтому таблицы можно строить и сортировать при компиляции
+// (см. constexpr_sort ниже) — они попадают в бинарник готовыми.
+// Во время выполнения fill и сравнение на равенство больших массивов
+// арифметических типов идут через векторные ядра simd.h
+template <typename T, std::size_t N>
+struct array {
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = std::size_t;
+
+    // -------------------  доступ к элементам -------------------
+    constexpr reference at(size_type pos) {
+        if (pos >= N)
+            throw std::out_of_range("Index out of range");
+        return data_[pos];
+    }
+    constexpr const_reference at(size_type pos) const {
+        if (pos >= N)
+            throw std::out_of_range("Index out of range");
+        return data_[pos];
+    }
+    constexpr reference operator[](size_type pos) { return data_[pos]; }
+    constexpr const_reference operator[](size_type pos) const { return data_[pos]; }
+    constexpr reference front() { return data_[0]; }
+    constexpr const_reference front() const { return data_[0]; }
+    constexpr reference back() { return data_[N - 1]; }
+    constexpr const_reference back() const { return data_[N - 1]; }
+    constexpr T* data() noexcept { return data_; }
+    constexpr const T* data() const noexcept { return data_; }
+
+    // ------------------- итераторы -------------------
+    constexpr iterator begin() noexcept { return data_; }
+    constexpr iterator end() noexcept { return data_ + N; }
+    constexpr const_iterator begin() const noexcept { return data_; }
+    constexpr const_iterator end() const noexcept { return data_ + N; }
+
+    // ------------------- ёмкость -------------------
+    constexpr bool empty() const noexcept { return N == 0; }
+    constexpr size_type size() const noexcept { return N; }
+    constexpr size_type max_size() const noexcept { return N; }
+
+    // ------------------- модификаторы -------------------
+    constexpr void fill(const_reference value);
+    constexpr void swap(array& other) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                               std::is_nothrow_move_assignable<T>::value);
+
+    // открытый, иначе array не агрегат. При N == 0 хранится один
+    // неиспользуемый элемент: массивов нулевой длины в C++ нет
+    T data_[N == 0 ? 1 : N];
+};
+
+// ------------------------------------- алгоритмы времени компиляции -------------------------------------
+// std::swap, std::sort и std::find станут constexpr только в C++20, поэтому
+// здесь свои версии. Сортировка — пирамидальная: O(n log n) в худшем
+// случае, без рекурсии и без дополнительной памяти, которой в constexpr
+// C++17 не выделить. Она неустойчивая, а во время выполнения std::sort быстрее
+
+template <typename T>
+constexpr void constexprSwap(T& first, T& second) {
+    T moved = std::move(first);
+    first = std::move(second);
+    second = std::move(moved);
+}
+
+// просеивает first[root] вниз по куче из n элементов
+template <typename RandomIt, typename Compare>
+constexpr void constexprSiftDown(RandomIt first, std::size_t root, std::size_t n, Compare& comp) {
+    for (std::size_t child = 2 * root + 1; child < n; child = 2 * root + 1) {
+        if (child + 1 < n && comp(first[child], first[child + 1]))
+            ++child;
+        if (!comp(first[root], first[child]))
+            return;
+        constexprSwap(first[root], first[child]);
+        root = child;
+    }
+}
+
+template <typename RandomIt, typename Compare>
+constexpr void constexpr_sort(RandomIt first, RandomIt last, Compare comp) {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    for (std::size_t root = n / 2; root-- > 0;)
+        constexprSiftDown(first, root, n, comp);
+    for (std::size_t end = n; end > 1; --end) {
+        constexprSwap(first[0], first[end - 1]);
+        constexprSiftDown(first, 0, end - 1, comp);
+    }
+}
+
+template <typename RandomIt>
+constexpr void constexpr_sort(RandomIt first, RandomIt last) {
+    constexpr_sort(first, last, std::less<>());
+}
+
+template <typename InputIt, typename T>
+constexpr InputIt constexpr_find(InputIt first, InputIt last, const T& value) {
+    for (; first != last; ++first) {
+        if (*first == value)
+            return first;
+    }
+    return last;
+}
+
+template <typename RandomIt, typename T, typename Compare>
+constexpr RandomIt constexpr_lower_bound(RandomIt first, RandomIt last, const T& value, Compare comp) {
+    std::size_t n = static_cast<std::size_t>(last - first);
+    while (n > 0) {
+        const std::size_t half = n / 2;
+        if (comp(first[half], value)) {
+            first += half + 1;
+            n -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+    return first;
+}
+
+template <typename RandomIt, typename T>
+constexpr RandomIt constexpr_lower_bound(RandomIt first, RandomIt last, const T& value) {
+    return constexpr_lower_bound(first, last, value, std::less<>());
+}
+
+// ------------------------------------- модификаторы -------------------------------------
+
+// маленькие массивы быстрее заполнить циклом, чем звать ядро
+constexpr std::size_t kArraySimdMinBytes = 64;
+
+template <typename T, std::size_t N>
+constexpr void array<T, N>::fill(const_reference value) {
+#if S21_SIMD_X86
+    if constexpr (kSimdKernelType<T> && N * sizeof(T) >= kArraySimdMinBytes) {
+        if (!__builtin_is_constant_evaluated()) {
+            simd_fill(data_, data_ + N, value);
+            return;
+        }
+    }
+#endif
+    for (size_type i = 0; i < N; ++i)
+        data_[i] = value;
+}
+
+template <typename T, std::size_t N>
+constexpr void array<T, N>::swap(array& other) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                                        std::is_nothrow_move_assignable<T>::value) {
+    for (size_type i = 0; i < N; ++i)
+        constexprSwap(data_[i], other.data_[i]);
+}
+
+// ------------------------------------- сравнение -------------------------------------
+
+template <typename T, std::size_t N>
+constexpr bool operator==(const array<T, N>& left, const array<T, N>& right) {
+#if S21_SIMD_X86
+    if constexpr (kSimdKernelType<T> && N * sizeof(T) >= kArraySimdMinBytes) {
+        if (!__builtin_is_constant_evaluated())
+            return simd_equal(left.begin(), left.end(), right.begin());
+    }
+#endif
+    for (std::size_t i = 0; i < N; ++i) {
+        if (!(left[i] == right[i]))
+            return false;
+    }
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator!=(const array<T, N>& left, const array<T, N>& right) {
+    return !(left == right);
+}
+
+// лексикографически, как std::array
+template <typename T, std::size_t N>
+constexpr bool operator<(const array<T, N>& left, const array<T, N>& right) {
+    for (std::size_t i = 0; i < N; ++i) {
+        if (left[i] < right[i])
+            return true;
+        if (right[i] < left[i])
+            return false;
+    }
+    return false;
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator>(const array<T, N>& left, const array<T, N>& right) {
+    return right < left;
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator<=(const array<T, N>& left, const array<T, N>& right) {
+    return !(right < left);
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator>=(const array<T, N>& left, const array<T, N>& right) {
+    return !(left < right);
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_ARRAY_H
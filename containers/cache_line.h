@@ -0,0 +1,15 @@
+#ifndef S21_CONTAINERS_CACHE_LINE_H
+#define S21_CONTAINERS_CACHE_LINE_H
+
+#include <cstddef>
+
+namespace s21 {
+
+// размер строки кэша, по которому разносятся счётчики разных потоков.
+// std::hardware_destructive_interference_size есть не во всех стандартных
+// библиотеках, а 64 байта верно для x86-64 и большинства ARM
+constexpr std::size_t kCacheLineSize = 64;
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_CACHE_LINE_H
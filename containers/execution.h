@@ -0,0 +1,64 @@
+#ifndef S21_CONTAINERS_EXECUTION_H
+#define S21_CONTAINERS_EXECUTION_H
+
+#include <type_traits>
+
+#include "thread_pool.h"
+
+namespace s21 {
+namespace execution {
+
+// Политики выполнения для алгоритмов библиотеки, по образцу std::execution.
+// Параллельные политики раздают работу пулу: по умолчанию общему
+// thread_pool::shared(), par.on(pool) — своему (например, чтобы задать
+// число потоков)
+
+// всё выполняется в вызывающем потоке
+class sequenced_policy {};
+
+class parallel_policy {
+public:
+    constexpr parallel_policy() noexcept = default;
+    constexpr explicit parallel_policy(thread_pool& pool) noexcept : pool_(&pool) {}
+
+    parallel_policy on(thread_pool& pool) const noexcept { return parallel_policy(pool); }
+    thread_pool& pool() const { return pool_ != nullptr ? *pool_ : thread_pool::shared(); }
+
+private:
+    thread_pool* pool_ = nullptr;
+};
+
+// вдобавок разрешает векторизовать итерации внутри одной задачи: тело не
+// должно брать блокировки и зависеть от порядка итераций
+class parallel_unsequenced_policy : public parallel_policy {
+public:
+    using parallel_policy::parallel_policy;
+
+    parallel_unsequenced_policy on(thread_pool& pool) const noexcept { return parallel_unsequenced_policy(pool); }
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+template <typename T>
+struct is_execution_policy : std::false_type {};
+template <>
+struct is_execution_policy<sequenced_policy> : std::true_type {};
+template <>
+struct is_execution_policy<parallel_policy> : std::true_type {};
+template <>
+struct is_execution_policy<parallel_unsequenced_policy> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+// для enable_if в перегрузках контейнеров: Policy может прийти ссылкой
+template <typename Policy>
+using enable_if_execution_policy =
+    typename std::enable_if<is_execution_policy_v<typename std::decay<Policy>::type>>::type;
+
+} // namespace execution
+} // namespace s21
+
+#endif // S21_CONTAINERS_EXECUTION_H
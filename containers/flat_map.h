@@ -0,0 +1,369 @@
+#ifndef S21_CONTAINERS_FLAT_MAP_H
+#define S21_CONTAINERS_FLAT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "flat_search.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Словарь в двух параллельных отсортированных массивах: ключи отдельно от
+// значений. Поиск бежит только по плотному массиву ключей, значения
+// трогаются один раз в конце. Как и flat_set, рассчитан на построение
+// пачкой и частое чтение: одиночная вставка и удаление — O(n).
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map {
+    template <bool Const>
+    class FlatMapIterator;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    // пары в памяти нет, поэтому итератор отдаёт пару ссылок
+    using reference = std::pair<const Key&, T&>;
+    using const_reference = std::pair<const Key&, const T&>;
+    using iterator = FlatMapIterator<false>;
+    using const_iterator = FlatMapIterator<true>;
+    using size_type = size_t;
+    using key_compare = Compare;
+    using key_container_type = vector<Key>;
+    using mapped_container_type = vector<T>;
+
+    // -------------------  конструкторы -------------------
+    flat_map() = default;
+    explicit flat_map(const Compare& comp) : comp_(comp) {}
+    flat_map(std::initializer_list<value_type> const &items) : flat_map(items.begin(), items.end()) {}
+    // неотсортированный диапазон пар: O(n log n), из равных ключей остаётся первый
+    template <typename InputIt>
+    flat_map(InputIt first, InputIt last, const Compare& comp = Compare());
+
+    // -------------------  доступ к элементам -------------------
+    T& at(const Key& key);
+    const T& at(const Key& key) const;
+    T& operator[](const Key& key);
+
+    // ------------------- итераторы и ёмкость -------------------
+    iterator begin() noexcept { return iterator(keys_.data(), values_.data()); }
+    iterator end() noexcept { return begin() + keys_.size(); }
+    const_iterator begin() const noexcept { return const_iterator(keys_.data(), values_.data()); }
+    const_iterator end() const noexcept { return begin() + keys_.size(); }
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+    size_type max_size() const noexcept { return std::min(keys_.max_size(), values_.max_size()); }
+    void reserve(size_type size);
+    const key_container_type& keys() const noexcept { return keys_; }
+    const mapped_container_type& values() const noexcept { return values_; }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept;
+    std::pair<iterator, bool> insert(const value_type& value) { return insert(value.first, value.second); }
+    std::pair<iterator, bool> insert(const Key& key, const T& obj);
+    std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+    // пачка сортируется отдельно и сливается с имеющимися парами за один
+    // проход в новые массивы: O(n + m log m)
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last);
+    template <typename... Args>
+    vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+    iterator erase(const_iterator pos);
+    size_type erase(const Key& key);
+    void swap(flat_map& other) noexcept;
+
+    // ------------------- поиск -------------------
+    iterator lower_bound(const Key& key) { return begin() + lowerIndex(key); }
+    const_iterator lower_bound(const Key& key) const { return begin() + lowerIndex(key); }
+    iterator upper_bound(const Key& key) { return begin() + flatUpperBound(keys_.data(), keys_.size(), key, comp_); }
+    const_iterator upper_bound(const Key& key) const { return begin() + flatUpperBound(keys_.data(), keys_.size(), key, comp_); }
+    iterator find(const Key& key) { return begin() + findIndex(key); }
+    const_iterator find(const Key& key) const { return begin() + findIndex(key); }
+    bool contains(const Key& key) const { return findIndex(key) != keys_.size(); }
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+    key_compare key_comp() const { return comp_; }
+
+private:
+    size_type lowerIndex(const Key& key) const { return flatLowerBound(keys_.data(), keys_.size(), key, comp_); }
+    // индекс ключа или size(), если ключа нет
+    size_type findIndex(const Key& key) const;
+    bool sameKey(const Key& lhs, const Key& rhs) const { return !comp_(lhs, rhs) && !comp_(rhs, lhs); }
+    template <typename... Args>
+    iterator insertAt(size_type index, const Key& key, Args&&... args);
+
+    key_container_type keys_;
+    mapped_container_type values_;
+    mutable Compare comp_;
+};
+
+// итератор — пара указателей на ключ и значение с одинаковым индексом.
+// Произвольный доступ есть, но разыменование даёт временную пару ссылок,
+// поэтому operator-> возвращает обёртку с этой парой внутри
+template <typename Key, typename T, typename Compare>
+template <bool Const>
+class flat_map<Key, T, Compare>::FlatMapIterator {
+    using mapped_pointer = typename std::conditional<Const, const T*, T*>::type;
+    using pair_type = std::pair<const Key&, typename std::conditional<Const, const T&, T&>::type>;
+
+    struct Arrow {
+        pair_type pair;
+        const pair_type* operator->() const { return &pair; }
+    };
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::pair<Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference = pair_type;
+    using pointer = Arrow;
+
+    FlatMapIterator() = default;
+    FlatMapIterator(const Key* key, mapped_pointer value) : key_(key), value_(value) {}
+    // iterator -> const_iterator
+    template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+    FlatMapIterator(const FlatMapIterator<OtherConst>& other) : key_(other.key_), value_(other.value_) {}
+
+    reference operator*() const { return reference(*key_, *value_); }
+    Arrow operator->() const { return Arrow{**this}; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    FlatMapIterator& operator++() {
+        ++key_;
+        ++value_;
+        return *this;
+    }
+
+    // постфиксный
+    FlatMapIterator operator++(int) {
+        FlatMapIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    FlatMapIterator& operator--() {
+        --key_;
+        --value_;
+        return *this;
+    }
+
+    // постфиксный
+    FlatMapIterator operator--(int) {
+        FlatMapIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    FlatMapIterator& operator+=(difference_type n) {
+        key_ += n;
+        value_ += n;
+        return *this;
+    }
+
+    FlatMapIterator& operator-=(difference_type n) { return *this += -n; }
+    FlatMapIterator operator+(difference_type n) const { return FlatMapIterator(*this) += n; }
+    FlatMapIterator operator-(difference_type n) const { return FlatMapIterator(*this) -= n; }
+    difference_type operator-(const FlatMapIterator& other) const { return key_ - other.key_; }
+
+    bool operator==(const FlatMapIterator& other) const { return key_ == other.key_; }
+    bool operator!=(const FlatMapIterator& other) const { return key_ != other.key_; }
+    bool operator<(const FlatMapIterator& other) const { return key_ < other.key_; }
+
+private:
+    template <bool>
+    friend class FlatMapIterator;
+    friend class flat_map;
+
+    const Key* key_ = nullptr;
+    mapped_pointer value_ = nullptr;
+};
+
+// ------------------------------------- построение -------------------------------------
+
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+flat_map<Key, T, Compare>::flat_map(InputIt first, InputIt last, const Compare& comp) : comp_(comp) {
+    insert(first, last);
+}
+
+// новые пары собираются во временный массив, устойчиво сортируются,
+// повторы среди них отбрасываются (остаётся первый), и всё сливается со
+// старыми; при равных ключах побеждает уже лежащий в словаре. Старые пары
+// переносятся перемещением, только если оно не бросает ни для ключа, ни
+// для значения, — иначе копируются, и при исключении словарь не меняется
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+void flat_map<Key, T, Compare>::insert(InputIt first, InputIt last) {
+    vector<value_type> incoming;
+    for (; first != last; ++first)
+        incoming.push_back(value_type(*first));
+    if (incoming.empty())
+        return;
+    std::stable_sort(incoming.begin(), incoming.end(),
+                     [this](const value_type& lhs, const value_type& rhs) { return comp_(lhs.first, rhs.first); });
+    auto unique = std::unique(incoming.begin(), incoming.end(),
+                              [this](const value_type& lhs, const value_type& rhs) { return sameKey(lhs.first, rhs.first); });
+    incoming.erase(unique, incoming.end());
+
+    constexpr bool kMoveOld = std::is_nothrow_move_constructible<Key>::value &&
+                              std::is_nothrow_move_constructible<T>::value;
+    key_container_type keys;
+    mapped_container_type values;
+    keys.reserve(keys_.size() + incoming.size());
+    values.reserve(keys_.size() + incoming.size());
+    auto takeOld = [this, &keys, &values](size_type index) {
+        if constexpr (kMoveOld) {
+            keys.push_back(std::move(keys_[index]));
+            values.push_back(std::move(values_[index]));
+        } else {
+            keys.push_back(keys_[index]);
+            values.push_back(values_[index]);
+        }
+    };
+    size_type old = 0;
+    for (value_type& item : incoming) {
+        for (; old < keys_.size() && comp_(keys_[old], item.first); ++old)
+            takeOld(old);
+        if (old < keys_.size() && !comp_(item.first, keys_[old]))
+            continue;
+        keys.push_back(std::move(item.first));
+        values.push_back(std::move(item.second));
+    }
+    for (; old < keys_.size(); ++old)
+        takeOld(old);
+    keys_.swap(keys);
+    values_.swap(values);
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::reserve(size_type size) {
+    keys_.reserve(size);
+    values_.reserve(size);
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::clear() noexcept {
+    keys_.clear();
+    values_.clear();
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::swap(flat_map& other) noexcept {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+}
+
+// ------------------------------------- доступ -------------------------------------
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type flat_map<Key, T, Compare>::findIndex(const Key& key) const {
+    size_type index = lowerIndex(key);
+    if (index == keys_.size() || comp_(key, keys_[index]))
+        return keys_.size();
+    return index;
+}
+
+template <typename Key, typename T, typename Compare>
+T& flat_map<Key, T, Compare>::at(const Key& key) {
+    size_type index = findIndex(key);
+    if (index == keys_.size())
+        throw std::out_of_range("Key not found");
+    return values_[index];
+}
+
+template <typename Key, typename T, typename Compare>
+const T& flat_map<Key, T, Compare>::at(const Key& key) const {
+    size_type index = findIndex(key);
+    if (index == keys_.size())
+        throw std::out_of_range("Key not found");
+    return values_[index];
+}
+
+template <typename Key, typename T, typename Compare>
+T& flat_map<Key, T, Compare>::operator[](const Key& key) {
+    size_type index = lowerIndex(key);
+    if (index == keys_.size() || comp_(key, keys_[index]))
+        insertAt(index, key);
+    return values_[index];
+}
+
+// ------------------------------------- вставка и удаление -------------------------------------
+
+// значение вставляется первым: если бросит вставка ключа, его откатываем,
+// и массивы остаются одной длины
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::insertAt(size_type index, const Key& key, Args&&... args) {
+    values_.emplace(values_.begin() + index, std::forward<Args>(args)...);
+    try {
+        keys_.insert(keys_.begin() + index, key);
+    } catch (...) {
+        values_.erase(values_.begin() + index);
+        throw;
+    }
+    return begin() + index;
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::insert(const Key& key, const T& obj) {
+    size_type index = lowerIndex(key);
+    if (index != keys_.size() && !comp_(key, keys_[index]))
+        return {begin() + index, false};
+    return {insertAt(index, key, obj), true};
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool> flat_map<Key, T, Compare>::insert_or_assign(const Key& key, const T& obj) {
+    size_type index = lowerIndex(key);
+    if (index != keys_.size() && !comp_(key, keys_[index])) {
+        values_[index] = obj;
+        return {begin() + index, false};
+    }
+    return {insertAt(index, key, obj), true};
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+vector<std::pair<typename flat_map<Key, T, Compare>::iterator, bool>> flat_map<Key, T, Compare>::insert_many(Args&&... args) {
+    // массивы сдвигаются при каждой вставке, поэтому итераторы строятся
+    // по ключам после всех вставок
+    vector<std::pair<Key, bool>> inserted;
+    inserted.reserve(sizeof...(Args));
+    auto insertOne = [this, &inserted](const value_type& value) {
+        inserted.emplace_back(value.first, insert(value).second);
+    };
+    (insertOne(value_type(std::forward<Args>(args))), ...);
+    vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    for (auto& item : inserted)
+        result.push_back({find(item.first), item.second});
+    return result;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::erase(const_iterator pos) {
+    size_type index = static_cast<size_type>(pos.key_ - keys_.data());
+    keys_.erase(keys_.begin() + index);
+    values_.erase(values_.begin() + index);
+    return begin() + index;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type flat_map<Key, T, Compare>::erase(const Key& key) {
+    size_type index = findIndex(key);
+    if (index == keys_.size())
+        return 0;
+    keys_.erase(keys_.begin() + index);
+    values_.erase(values_.begin() + index);
+    return 1;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_FLAT_MAP_H
@@ -0,0 +1,50 @@
+#ifndef S21_CONTAINERS_FLAT_SEARCH_H
+#define S21_CONTAINERS_FLAT_SEARCH_H
+
+#include <cstddef>
+
+namespace s21 {
+
+// Двоичный поиск без ветвлений для flat_map/flat_set. Окно [base, base + n)
+// каждый шаг сжимается вдвое, а сдвиг base выбирается условным присваиванием,
+// которое компилятор превращает в cmov: нет промахов предсказателя, и
+// следующий адрес зависит только от загруженного ключа. На больших массивах
+// обе возможные середины следующего шага заранее подтягиваются в кеш.
+
+template <typename Key, typename Compare>
+std::size_t flatLowerBound(const Key* first, std::size_t n, const Key& key, Compare& comp) {
+    if (n == 0)
+        return 0;
+    const Key* base = first;
+    while (n > 1) {
+        std::size_t half = n / 2;
+#if defined(__GNUC__)
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+#endif
+        base = comp(base[half], key) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<std::size_t>(base - first) + (comp(*base, key) ? 1 : 0);
+}
+
+template <typename Key, typename Compare>
+std::size_t flatUpperBound(const Key* first, std::size_t n, const Key& key, Compare& comp) {
+    if (n == 0)
+        return 0;
+    const Key* base = first;
+    while (n > 1) {
+        std::size_t half = n / 2;
+#if defined(__GNUC__)
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+#endif
+        base = comp(key, base[half]) ? base : base + half;
+        n -= half;
+    }
+    return static_cast<std::size_t>(base - first) + (comp(key, *base) ? 0 : 1);
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_FLAT_SEARCH_H
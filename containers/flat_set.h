@@ -0,0 +1,175 @@
+#ifndef S21_CONTAINERS_FLAT_SET_H
+#define S21_CONTAINERS_FLAT_SET_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "flat_search.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Множество в отсортированном непрерывном массиве. Поиск — двоичный без
+// ветвлений по плотному массиву ключей, обход — линейный проход по памяти.
+// Вставка и удаление одного ключа сдвигают хвост (O(n)), поэтому контейнер
+// рассчитан на "построить один раз пачкой, потом много читать"
+template <typename Key, typename Compare = std::less<Key>>
+class flat_set {
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = const Key*;
+    using const_iterator = const Key*;
+    using size_type = size_t;
+    using key_compare = Compare;
+    using container_type = vector<Key>;
+
+    // -------------------  конструкторы -------------------
+    flat_set() = default;
+    explicit flat_set(const Compare& comp) : comp_(comp) {}
+    flat_set(std::initializer_list<value_type> const &items) : flat_set(items.begin(), items.end()) {}
+    // неотсортированный диапазон: O(n log n), из равных ключей остаётся первый
+    template <typename InputIt>
+    flat_set(InputIt first, InputIt last, const Compare& comp = Compare());
+
+    // ------------------- итераторы и ёмкость -------------------
+    iterator begin() const noexcept { return keys_.data(); }
+    iterator end() const noexcept { return keys_.data() + keys_.size(); }
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+    size_type max_size() const noexcept { return keys_.max_size(); }
+    void reserve(size_type size) { keys_.reserve(size); }
+    const container_type& keys() const noexcept { return keys_; }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept { keys_.clear(); }
+    std::pair<iterator, bool> insert(const value_type& value) { return emplaceKey(value); }
+    std::pair<iterator, bool> insert(value_type&& value) { return emplaceKey(std::move(value)); }
+    // пачка дописывается в конец, сортируется и сливается с уже имеющимися
+    // ключами за один проход: O(n + m log m) вместо m сдвигов хвоста
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last);
+    template <typename... Args>
+    vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+    iterator erase(const_iterator pos) { return keys_.erase(pos); }
+    iterator erase(const_iterator first, const_iterator last) { return keys_.erase(first, last); }
+    size_type erase(const Key& key);
+    void swap(flat_set& other) noexcept;
+
+    // ------------------- поиск -------------------
+    iterator lower_bound(const Key& key) const { return begin() + flatLowerBound(keys_.data(), keys_.size(), key, comp_); }
+    iterator upper_bound(const Key& key) const { return begin() + flatUpperBound(keys_.data(), keys_.size(), key, comp_); }
+    std::pair<iterator, iterator> equal_range(const Key& key) const;
+    iterator find(const Key& key) const;
+    bool contains(const Key& key) const { return find(key) != end(); }
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+    key_compare key_comp() const { return comp_; }
+
+private:
+    template <typename V>
+    std::pair<iterator, bool> emplaceKey(V&& value);
+    void sortAndMerge(size_type sortedSize);
+
+    container_type keys_;
+    mutable Compare comp_;
+};
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+flat_set<Key, Compare>::flat_set(InputIt first, InputIt last, const Compare& comp) : comp_(comp) {
+    insert(first, last);
+}
+
+// [0, sortedSize) уже упорядочены и уникальны, хвост — как пришёл
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::sortAndMerge(size_type sortedSize) {
+    Key* first = keys_.data();
+    Key* middle = first + sortedSize;
+    Key* last = first + keys_.size();
+    auto equal = [this](const Key& lhs, const Key& rhs) { return !comp_(lhs, rhs) && !comp_(rhs, lhs); };
+    // stable: из равных новых ключей остаётся первый
+    std::stable_sort(middle, last, comp_);
+    last = std::unique(middle, last, equal);
+    // слияние устойчиво, поэтому старый ключ стоит перед равным новым
+    std::inplace_merge(first, middle, last, comp_);
+    last = std::unique(first, last, equal);
+    keys_.erase(last, keys_.data() + keys_.size());
+}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+void flat_set<Key, Compare>::insert(InputIt first, InputIt last) {
+    size_type sortedSize = keys_.size();
+    for (; first != last; ++first)
+        keys_.push_back(*first);
+    if (keys_.size() != sortedSize)
+        sortAndMerge(sortedSize);
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+vector<std::pair<typename flat_set<Key, Compare>::iterator, bool>> flat_set<Key, Compare>::insert_many(Args&&... args) {
+    // массив сдвигается при каждой вставке, поэтому итераторы строятся
+    // по ключам после всех вставок
+    vector<std::pair<Key, bool>> inserted;
+    inserted.reserve(sizeof...(Args));
+    auto insertOne = [this, &inserted](Key key) {
+        bool done = insert(key).second;
+        inserted.emplace_back(std::move(key), done);
+    };
+    (insertOne(Key(std::forward<Args>(args))), ...);
+    vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    for (auto& item : inserted)
+        result.push_back({find(item.first), item.second});
+    return result;
+}
+
+template <typename Key, typename Compare>
+template <typename V>
+std::pair<typename flat_set<Key, Compare>::iterator, bool> flat_set<Key, Compare>::emplaceKey(V&& value) {
+    iterator pos = lower_bound(value);
+    if (pos != end() && !comp_(value, *pos))
+        return {pos, false};
+    return {keys_.insert(pos, std::forward<V>(value)), true};
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::erase(const Key& key) {
+    iterator pos = find(key);
+    if (pos == end())
+        return 0;
+    keys_.erase(pos);
+    return 1;
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::swap(flat_set& other) noexcept {
+    keys_.swap(other.keys_);
+    std::swap(comp_, other.comp_);
+}
+
+template <typename Key, typename Compare>
+std::pair<typename flat_set<Key, Compare>::iterator, typename flat_set<Key, Compare>::iterator> flat_set<Key, Compare>::equal_range(const Key& key) const {
+    iterator pos = lower_bound(key);
+    if (pos != end() && !comp_(key, *pos))
+        return {pos, pos + 1};
+    return {pos, pos};
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::find(const Key& key) const {
+    iterator pos = lower_bound(key);
+    if (pos == end() || comp_(key, *pos))
+        return end();
+    return pos;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_FLAT_SET_H
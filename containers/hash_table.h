@@ -0,0 +1,648 @@
+#ifndef S21_CONTAINERS_HASH_TABLE_H
+#define S21_CONTAINERS_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Хеш-таблица с открытой адресацией — общий движок unordered_map и
+// unordered_set. Слоты лежат одним массивом, рядом с каждым слотом —
+// управляющий байт: свободен, удалён или занят (тогда в байте 7 младших
+// бит хеша, h2). Слоты разбиты на группы по 16; поиск сравнивает h2 сразу
+// со всеми 16 байтами группы (одна SSE2-инструкция или скалярный цикл,
+// если SSE2 нет) и трогает сами значения только при совпадении байта.
+// Группы перебираются треугольными шагами, начиная с группы по старшим
+// битам хеша.
+
+using HashCtrl = signed char;
+
+// у свободного и удалённого байта старший бит установлен, у занятого — нет;
+// страж за последним слотом останавливает итератор
+constexpr HashCtrl kCtrlEmpty = -128;
+constexpr HashCtrl kCtrlDeleted = -2;
+constexpr HashCtrl kCtrlSentinel = -1;
+constexpr std::size_t kHashGroupWidth = 16;
+
+inline unsigned hashLowestBit(std::uint32_t mask) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+    unsigned index = 0;
+    for (; (mask & 1u) == 0; mask >>= 1)
+        ++index;
+    return index;
+#endif
+}
+
+// 16 управляющих байтов одной группы; методы возвращают битовую маску
+// подходящих слотов (i-й бит — i-й слот группы)
+class HashGroup {
+public:
+#if defined(__SSE2__)
+    explicit HashGroup(const HashCtrl* ctrl) : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+    std::uint32_t match(HashCtrl h2) const {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+    }
+
+    // свободные и удалённые — ровно байты со знаковым битом
+    std::uint32_t matchFree() const { return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_)); }
+
+private:
+    __m128i ctrl_;
+#else
+    explicit HashGroup(const HashCtrl* ctrl) : ctrl_(ctrl) {}
+
+    std::uint32_t match(HashCtrl h2) const {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < kHashGroupWidth; ++i)
+            mask |= static_cast<std::uint32_t>(ctrl_[i] == h2) << i;
+        return mask;
+    }
+
+    std::uint32_t matchFree() const {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < kHashGroupWidth; ++i)
+            mask |= static_cast<std::uint32_t>(ctrl_[i] < 0) << i;
+        return mask;
+    }
+
+private:
+    const HashCtrl* ctrl_;
+#endif
+
+public:
+    std::uint32_t matchEmpty() const { return match(kCtrlEmpty); }
+};
+
+// поиск по ключу другого типа (find("abc") в таблице std::string) включается,
+// только если и хеш, и сравнение объявили is_transparent
+template <typename T, typename = void>
+struct HashIsTransparent : std::false_type {};
+
+template <typename T>
+struct HashIsTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type {};
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+class hash_table {
+    template <bool Const>
+    class HashIterator;
+
+    template <typename K>
+    using transparent_key =
+        typename std::enable_if<HashIsTransparent<Hash>::value && HashIsTransparent<KeyEqual>::value, K>::type;
+
+public:
+    using key_type = Key;
+    using value_type = Value;
+    using reference = Value&;
+    using const_reference = const Value&;
+    using iterator = HashIterator<false>;
+    using const_iterator = HashIterator<true>;
+    using size_type = size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Allocator;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    hash_table() = default;
+    explicit hash_table(size_type bucketCount, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                        const allocator_type& alloc = allocator_type());
+    hash_table(const hash_table& other);
+    hash_table(hash_table&& other) noexcept;
+    ~hash_table();
+
+    hash_table& operator=(const hash_table& other);
+    hash_table& operator=(hash_table&& other) noexcept(std::allocator_traits<Allocator>::is_always_equal::value ||
+                                                       std::allocator_traits<Allocator>::
+                                                           propagate_on_container_move_assignment::value);
+
+    // ------------------- итераторы и ёмкость -------------------
+    iterator begin() noexcept { return iterator(firstFull(), ctrl_, slots_); }
+    iterator end() noexcept { return iterator(capacity_, ctrl_, slots_); }
+    const_iterator begin() const noexcept { return const_iterator(firstFull(), ctrl_, slots_); }
+    const_iterator end() const noexcept { return const_iterator(capacity_, ctrl_, slots_); }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type max_size() const noexcept { return slot_traits::max_size(alloc_) / 2; }
+    size_type bucket_count() const noexcept { return capacity_; }
+    float load_factor() const noexcept { return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_); }
+    float max_load_factor() const noexcept { return maxLoad_; }
+    void max_load_factor(float load);
+    void reserve(size_type count);
+    void rehash(size_type count);
+    hasher hash_function() const { return hash_; }
+    key_equal key_eq() const { return equal_; }
+    allocator_type get_allocator() const { return alloc_; }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept;
+
+    // Args строят значение по ключу key, если его в таблице ещё нет
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> tryEmplace(const K& key, Args&&... args);
+    // ключ неизвестен до постройки значения: строим временное и переносим
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args);
+
+    iterator erase(const_iterator pos);
+    size_type erase(const key_type& key);
+    void swap(hash_table& other) noexcept;
+
+    // ------------------- поиск -------------------
+    iterator find(const key_type& key) { return iterator(findIndex(key), ctrl_, slots_); }
+    const_iterator find(const key_type& key) const { return const_iterator(findIndex(key), ctrl_, slots_); }
+    template <typename K, typename = transparent_key<K>>
+    iterator find(const K& key) { return iterator(findIndex(key), ctrl_, slots_); }
+    template <typename K, typename = transparent_key<K>>
+    const_iterator find(const K& key) const { return const_iterator(findIndex(key), ctrl_, slots_); }
+    bool contains(const key_type& key) const { return findIndex(key) != capacity_; }
+    template <typename K, typename = transparent_key<K>>
+    bool contains(const K& key) const { return findIndex(key) != capacity_; }
+
+private:
+    using slot_traits = std::allocator_traits<Allocator>;
+    using ctrl_allocator = typename slot_traits::template rebind_alloc<HashCtrl>;
+
+    static const key_type& keyOf(const Value& value) { return KeyOfValue()(value); }
+
+    // std::hash для целых — тождество, поэтому хеш перемешивается, чтобы
+    // и номер группы, и h2 зависели от всех битов ключа
+    template <typename K>
+    std::uint64_t hashOf(const K& key) const;
+    static HashCtrl h2Of(std::uint64_t hash) { return static_cast<HashCtrl>(hash & 0x7F); }
+    std::size_t groupOf(std::uint64_t hash) const { return static_cast<std::size_t>(hash >> 7) & (capacity_ / kHashGroupWidth - 1); }
+
+    template <typename K>
+    size_type findIndex(const K& key) const { return size_ == 0 ? capacity_ : findIndex(key, hashOf(key)); }
+    template <typename K>
+    size_type findIndex(const K& key, std::uint64_t hash) const;
+    size_type findFreeSlot(std::uint64_t hash) const;
+    size_type prepareInsert(std::uint64_t hash);
+    void setCtrl(size_type index, HashCtrl value) { ctrl_[index] = value; }
+    size_type firstFull() const noexcept;
+    size_type growthLimit() const { return static_cast<size_type>(static_cast<double>(capacity_) * maxLoad_); }
+    size_type capacityFor(size_type count) const;
+
+    void resize(size_type newCapacity);
+    void allocateArrays(size_type capacity);
+    void destroyAll() noexcept;
+    void deallocateArrays() noexcept;
+    template <typename Source>
+    void copyFrom(Source& other);
+    void stealFrom(hash_table& other) noexcept;
+
+    HashCtrl* ctrl_ = nullptr;
+    Value* slots_ = nullptr;
+    size_type capacity_ = 0;
+    size_type size_ = 0;
+    // сколько свободных (не удалённых) слотов можно ещё занять до роста
+    size_type growthLeft_ = 0;
+    float maxLoad_ = 0.875f;
+    Hash hash_;
+    KeyEqual equal_;
+    Allocator alloc_;
+};
+
+// итератор — номер слота и указатели на массивы; ++ пропускает свободные
+// и удалённые слоты до следующего занятого или стража
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+template <bool Const>
+class hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::HashIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<Const, const Value*, Value*>::type;
+    using reference = typename std::conditional<Const, const Value&, Value&>::type;
+
+    HashIterator() = default;
+    HashIterator(size_type index, const HashCtrl* ctrl, Value* slots) : ctrl_(ctrl + index), slot_(slots + index) {}
+    // iterator -> const_iterator
+    template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+    HashIterator(const HashIterator<OtherConst>& other) : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+    reference operator*() const { return *slot_; }
+    pointer operator->() const { return slot_; }
+
+    HashIterator& operator++() {
+        do {
+            ++ctrl_;
+            ++slot_;
+        } while (*ctrl_ < kCtrlSentinel);
+        return *this;
+    }
+
+    // постфиксный
+    HashIterator operator++(int) {
+        HashIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    bool operator==(const HashIterator& other) const { return slot_ == other.slot_; }
+    bool operator!=(const HashIterator& other) const { return slot_ != other.slot_; }
+
+private:
+    template <bool>
+    friend class HashIterator;
+    friend class hash_table;
+
+    const HashCtrl* ctrl_ = nullptr;
+    Value* slot_ = nullptr;
+};
+
+// ------------------------------------- конструкторы и присваивания -------------------------------------
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::hash_table(size_type bucketCount, const Hash& hash, const KeyEqual& equal,
+                                                                          const allocator_type& alloc)
+    : hash_(hash), equal_(equal), alloc_(alloc) {
+    if (bucketCount != 0)
+        resize(capacityFor(bucketCount));
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::hash_table(const hash_table& other)
+    : maxLoad_(other.maxLoad_), hash_(other.hash_), equal_(other.equal_),
+      alloc_(slot_traits::select_on_container_copy_construction(other.alloc_)) {
+    copyFrom(other);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::hash_table(hash_table&& other) noexcept
+    : maxLoad_(other.maxLoad_), hash_(other.hash_), equal_(other.equal_), alloc_(other.alloc_) {
+    stealFrom(other);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::~hash_table() {
+    destroyAll();
+    deallocateArrays();
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>&
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::operator=(const hash_table& other) {
+    if (this == &other) return *this;
+    destroyAll();
+    deallocateArrays();
+    if (slot_traits::propagate_on_container_copy_assignment::value)
+        alloc_ = other.alloc_;
+    hash_ = other.hash_;
+    equal_ = other.equal_;
+    maxLoad_ = other.maxLoad_;
+    copyFrom(other);
+    return *this;
+}
+
+// как в tree: массивы other можно забрать, только если их сможет освободить
+// наш аллокатор, иначе значения переносятся в свои массивы слот в слот
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>&
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::operator=(hash_table&& other) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+    if (this == &other) return *this;
+    destroyAll();
+    deallocateArrays();
+    hash_ = other.hash_;
+    equal_ = other.equal_;
+    maxLoad_ = other.maxLoad_;
+    if (slot_traits::propagate_on_container_move_assignment::value)
+        alloc_ = other.alloc_;
+    else if (!slot_traits::is_always_equal::value && !(alloc_ == other.alloc_)) {
+        copyFrom(other);
+        other.clear();
+        return *this;
+    }
+    stealFrom(other);
+    return *this;
+}
+
+// копия повторяет раскладку исходной таблицы слот в слот — без хеширования.
+// Из const-таблицы значения копируются, из неконстантной — перемещаются
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+template <typename Source>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::copyFrom(Source& other) {
+    if (other.size_ == 0) return;
+    allocateArrays(other.capacity_);
+    size_type index = 0;
+    try {
+        for (; index < capacity_; ++index) {
+            if (other.ctrl_[index] < 0)
+                continue;
+            if constexpr (std::is_const<Source>::value)
+                slot_traits::construct(alloc_, slots_ + index, other.slots_[index]);
+            else
+                slot_traits::construct(alloc_, slots_ + index, std::move(other.slots_[index]));
+        }
+    } catch (...) {
+        while (index-- > 0)
+            if (other.ctrl_[index] >= 0)
+                slot_traits::destroy(alloc_, slots_ + index);
+        deallocateArrays();
+        throw;
+    }
+    std::memcpy(ctrl_, other.ctrl_, capacity_ + 1);
+    size_ = other.size_;
+    growthLeft_ = other.growthLeft_;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::stealFrom(hash_table& other) noexcept {
+    ctrl_ = other.ctrl_;
+    slots_ = other.slots_;
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+    growthLeft_ = other.growthLeft_;
+    other.ctrl_ = nullptr;
+    other.slots_ = nullptr;
+    other.capacity_ = other.size_ = other.growthLeft_ = 0;
+}
+
+// --------------------------------------- память -------------------------------------
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::allocateArrays(size_type capacity) {
+    ctrl_allocator ctrlAlloc(alloc_);
+    HashCtrl* ctrl = std::allocator_traits<ctrl_allocator>::allocate(ctrlAlloc, capacity + 1);
+    try {
+        slots_ = slot_traits::allocate(alloc_, capacity);
+    } catch (...) {
+        std::allocator_traits<ctrl_allocator>::deallocate(ctrlAlloc, ctrl, capacity + 1);
+        throw;
+    }
+    ctrl_ = ctrl;
+    capacity_ = capacity;
+    std::memset(ctrl_, kCtrlEmpty, capacity_);
+    ctrl_[capacity_] = kCtrlSentinel;
+    size_ = 0;
+    growthLeft_ = growthLimit();
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::destroyAll() noexcept {
+    if (!std::is_trivially_destructible<Value>::value) {
+        for (size_type index = 0; index < capacity_; ++index)
+            if (ctrl_[index] >= 0)
+                slot_traits::destroy(alloc_, slots_ + index);
+    }
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::deallocateArrays() noexcept {
+    if (capacity_ != 0) {
+        ctrl_allocator ctrlAlloc(alloc_);
+        std::allocator_traits<ctrl_allocator>::deallocate(ctrlAlloc, ctrl_, capacity_ + 1);
+        slot_traits::deallocate(alloc_, slots_, capacity_);
+    }
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = size_ = growthLeft_ = 0;
+}
+
+// наименьшая степень двойки, кратная группе, в которую count влезает
+// без превышения max_load_factor
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::size_type
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::capacityFor(size_type count) const {
+    size_type capacity = kHashGroupWidth;
+    while (static_cast<double>(capacity) * maxLoad_ < static_cast<double>(count)) {
+        if (capacity > max_size() / 2)
+            throw std::length_error("Hash table is too large");
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// переносит значения в новые массивы. При исключении (копия или хеш)
+// новая память освобождается; перенос идёт move_if_noexcept, поэтому
+// бросающие копии оставляют старую таблицу нетронутой
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::resize(size_type newCapacity) {
+    hash_table fresh(0, hash_, equal_, alloc_);
+    fresh.maxLoad_ = maxLoad_;
+    fresh.allocateArrays(newCapacity);
+    for (size_type index = 0; index < capacity_; ++index) {
+        if (ctrl_[index] < 0)
+            continue;
+        std::uint64_t hash = fresh.hashOf(keyOf(slots_[index]));
+        size_type target = fresh.findFreeSlot(hash);
+        slot_traits::construct(fresh.alloc_, fresh.slots_ + target, std::move_if_noexcept(slots_[index]));
+        fresh.setCtrl(target, h2Of(hash));
+        ++fresh.size_;
+        --fresh.growthLeft_;
+    }
+    destroyAll();
+    deallocateArrays();
+    stealFrom(fresh);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::max_load_factor(float load) {
+    // хотя бы один свободный слот на таблицу нужен, чтобы поиск остановился
+    if (!(load > 0.0f))
+        throw std::invalid_argument("max_load_factor must be positive");
+    maxLoad_ = load < 0.9375f ? load : 0.9375f;
+    // запас роста зависит от числа удалённых слотов, которое не хранится, —
+    // проще перестроить таблицу, заодно избавившись от них
+    if (capacity_ != 0) {
+        size_type capacity = capacityFor(size_);
+        resize(capacity > capacity_ ? capacity : capacity_);
+    }
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::reserve(size_type count) {
+    // удалённые слоты тоже съедают запас, поэтому сравнивается с ним
+    if (count > size_ + growthLeft_)
+        resize(capacityFor(count));
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::rehash(size_type count) {
+    if (count == 0 && size_ == 0) {
+        deallocateArrays();
+        return;
+    }
+    size_type capacity = capacityFor(size_);
+    while (capacity < count)
+        capacity *= 2;
+    resize(capacity);
+}
+
+// --------------------------------------- поиск -------------------------------------
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+std::uint64_t hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::hashOf(const K& key) const {
+    std::uint64_t hash = static_cast<std::uint64_t>(hash_(key));
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::size_type
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::findIndex(const K& key, std::uint64_t hash) const {
+    const HashCtrl h2 = h2Of(hash);
+    const size_type groupMask = capacity_ / kHashGroupWidth - 1;
+    size_type group = groupOf(hash);
+    for (size_type step = 1;; ++step) {
+        const size_type base = group * kHashGroupWidth;
+        HashGroup ctrl(ctrl_ + base);
+        for (std::uint32_t mask = ctrl.match(h2); mask != 0; mask &= mask - 1) {
+            size_type index = base + hashLowestBit(mask);
+            if (equal_(key, keyOf(slots_[index])))
+                return index;
+        }
+        // в группе со свободным слотом ни одна цепочка не продолжалась
+        if (ctrl.matchEmpty() != 0)
+            return capacity_;
+        group = (group + step) & groupMask;
+    }
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::size_type
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::findFreeSlot(std::uint64_t hash) const {
+    const size_type groupMask = capacity_ / kHashGroupWidth - 1;
+    size_type group = groupOf(hash);
+    for (size_type step = 1;; ++step) {
+        const size_type base = group * kHashGroupWidth;
+        std::uint32_t mask = HashGroup(ctrl_ + base).matchFree();
+        if (mask != 0)
+            return base + hashLowestBit(mask);
+        group = (group + step) & groupMask;
+    }
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::size_type
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::firstFull() const noexcept {
+    for (size_type base = 0; base < capacity_; base += kHashGroupWidth) {
+        std::uint32_t full = ~HashGroup(ctrl_ + base).matchFree() & 0xFFFFu;
+        if (full != 0)
+            return base + hashLowestBit(full);
+    }
+    return capacity_;
+}
+
+// --------------------------------------- вставка и удаление -------------------------------------
+
+// слот под новый ключ. Удалённый слот занимается без роста таблицы; если
+// свободных слотов в запасе нет, таблица растёт вдвое или, когда место
+// съедено удалёнными, перестраивается в том же размере
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::size_type
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::prepareInsert(std::uint64_t hash) {
+    if (capacity_ == 0) {
+        resize(capacityFor(1));
+    }
+    size_type index = findFreeSlot(hash);
+    if (growthLeft_ == 0 && ctrl_[index] != kCtrlDeleted) {
+        resize(size_ < growthLimit() / 2 ? capacity_ : capacity_ * 2);
+        index = findFreeSlot(hash);
+    }
+    return index;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K, typename... Args>
+std::pair<typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::iterator, bool>
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::tryEmplace(const K& key, Args&&... args) {
+    const std::uint64_t hash = hashOf(key);
+    size_type found = size_ == 0 ? capacity_ : findIndex(key, hash);
+    if (found != capacity_)
+        return {iterator(found, ctrl_, slots_), false};
+    size_type index = prepareInsert(hash);
+    // байт помечается занятым только после успешной постройки значения
+    slot_traits::construct(alloc_, slots_ + index, std::forward<Args>(args)...);
+    if (ctrl_[index] == kCtrlEmpty)
+        --growthLeft_;
+    setCtrl(index, h2Of(hash));
+    ++size_;
+    return {iterator(index, ctrl_, slots_), true};
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+template <typename... Args>
+std::pair<typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::iterator, bool>
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::emplace(Args&&... args) {
+    Value value(std::forward<Args>(args)...);
+    return tryEmplace(keyOf(value), std::move(value));
+}
+
+// удалённый слот можно сразу сделать свободным, если в его группе уже есть
+// свободный: такая группа ни разу не заполнялась целиком, и ни одна
+// цепочка поиска через неё не проходила
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::iterator
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::erase(const_iterator pos) {
+    if (pos == end())
+        throw std::out_of_range("Cannot erase end()");
+    size_type index = static_cast<size_type>(pos.slot_ - slots_);
+    slot_traits::destroy(alloc_, slots_ + index);
+    const size_type base = index & ~(kHashGroupWidth - 1);
+    if (HashGroup(ctrl_ + base).matchEmpty() != 0) {
+        setCtrl(index, kCtrlEmpty);
+        ++growthLeft_;
+    } else {
+        setCtrl(index, kCtrlDeleted);
+    }
+    --size_;
+    iterator next(index, ctrl_, slots_);
+    return ++next;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+typename hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::size_type
+hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::erase(const key_type& key) {
+    size_type index = findIndex(key);
+    if (index == capacity_)
+        return 0;
+    erase(const_iterator(index, ctrl_, slots_));
+    return 1;
+}
+
+// массивы остаются: таблица, которую очистили, скорее всего заполнят снова
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::clear() noexcept {
+    if (capacity_ == 0) return;
+    destroyAll();
+    std::memset(ctrl_, kCtrlEmpty, capacity_);
+    size_ = 0;
+    growthLeft_ = growthLimit();
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual, typename Allocator>
+void hash_table<Key, Value, KeyOfValue, Hash, KeyEqual, Allocator>::swap(hash_table& other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growthLeft_, other.growthLeft_);
+    std::swap(maxLoad_, other.maxLoad_);
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+    std::swap(alloc_, other.alloc_);
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_HASH_TABLE_H
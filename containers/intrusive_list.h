@@ -0,0 +1,376 @@
+#ifndef S21_CONTAINERS_INTRUSIVE_LIST_H
+#define S21_CONTAINERS_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "list_links.h"
+
+namespace s21 {
+
+template <typename T, auto Hook>
+class intrusive_list;
+
+// Звено, встроенное в объект: через него объект вшивается в intrusive_list
+// без выделения памяти и без копирования. Не связанное звено хранит nullptr.
+// Пока объект в списке, его нельзя перемещать и разрушать. Копия объекта
+// получает чистое звено — в список попадает только оригинал
+class list_hook : protected list_links {
+public:
+    list_hook() noexcept : list_links{nullptr, nullptr} {}
+    list_hook(const list_hook&) noexcept : list_hook() {}
+    list_hook& operator=(const list_hook&) noexcept { return *this; }
+
+    bool is_linked() const noexcept { return pNext != nullptr; }
+
+protected:
+    // вынимает звено из кольца, в каком бы списке оно ни было, — O(1)
+    void unlinkSelf() noexcept {
+        if (is_linked()) {
+            unlinkNode(this);
+            pNext = pPrev = nullptr;
+        }
+    }
+
+private:
+    template <typename T, auto Hook>
+    friend class intrusive_list;
+};
+
+// звено, которое само выходит из списка при разрушении объекта и умеет
+// выйти по запросу. Список с такими звеньями не знает, когда его покинули,
+// поэтому его size() считает элементы проходом — O(n)
+class auto_unlink_list_hook : public list_hook {
+public:
+    auto_unlink_list_hook() noexcept = default;
+    auto_unlink_list_hook(const auto_unlink_list_hook&) noexcept : list_hook() {}
+    auto_unlink_list_hook& operator=(const auto_unlink_list_hook&) noexcept { return *this; }
+    ~auto_unlink_list_hook() { unlinkSelf(); }
+
+    void unlink() noexcept { unlinkSelf(); }
+};
+
+// Интрузивный список объектов T, связанных через член Hook (list_hook или
+// auto_unlink_list_hook): intrusive_list<Entry, &Entry::hook>.
+// Список не владеет объектами: push/insert вшивают сам объект, erase/clear
+// и деструктор только вынимают его. Вшивать можно только объект, чьё
+// звено не связано (is_linked() == false); в нескольких списках сразу
+// объект состоит через несколько звеньев.
+// splice, reverse, sort, merge — те же алгоритмы над связями, что у
+// s21::list; итераторы и ссылки ни одна операция не портит, кроме
+// итераторов на вынутые элементы
+template <typename T, auto Hook>
+class intrusive_list {
+    template <typename>
+    struct HookMember;
+    template <typename Hooked, typename H>
+    struct HookMember<H Hooked::*> {
+        using type = H;
+    };
+    using hook_type = typename HookMember<decltype(Hook)>::type;
+    static_assert(std::is_base_of<list_hook, hook_type>::value, "Hook must point to a list_hook member of T");
+    static constexpr bool kAutoUnlink = std::is_base_of<auto_unlink_list_hook, hook_type>::value;
+
+    template <bool Const>
+    class IntrusiveIterator;
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = IntrusiveIterator<false>;
+    using const_iterator = IntrusiveIterator<true>;
+    using size_type = size_t;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    intrusive_list() = default;
+    intrusive_list(const intrusive_list&) = delete;
+    intrusive_list(intrusive_list&& other) noexcept { stealLinks(other); }
+    ~intrusive_list() { clear(); }
+
+    intrusive_list& operator=(const intrusive_list&) = delete;
+    intrusive_list& operator=(intrusive_list&& other) noexcept;
+
+    // -------------------  доступ к элементам -------------------
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+    reference back() { return *(--end()); }
+    const_reference back() const { return *(--end()); }
+
+    // ------------------- итераторы -------------------
+    iterator begin() noexcept { return iterator(end_.pNext); }
+    iterator end() noexcept { return iterator(&end_); }
+    const_iterator begin() const noexcept { return const_iterator(end_.pNext); }
+    const_iterator end() const noexcept { return const_iterator(&end_); }
+    // итератор на объект, который уже в этом списке, — без поиска
+    static iterator iterator_to(reference value) noexcept { return iterator(hookOf(value)); }
+    static const_iterator iterator_to(const_reference value) noexcept { return const_iterator(hookOf(const_cast<T&>(value))); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const noexcept { return end_.pNext == &end_; }
+    size_type size() const noexcept;
+
+    // ------------------- модификаторы -------------------
+    void push_back(reference value) noexcept { insert(end(), value); }
+    void push_front(reference value) noexcept { insert(begin(), value); }
+    void pop_back();
+    void pop_front();
+    iterator insert(const_iterator pos, reference value) noexcept;
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last) noexcept;
+    // вынимает value из этого списка — O(1)
+    void remove(reference value) { erase(iterator_to(value)); }
+    void clear() noexcept;
+    void swap(intrusive_list& other) noexcept;
+    void splice(const_iterator pos, intrusive_list& other) noexcept;
+    // переносит один элемент it из other (или из этого же списка) перед pos
+    void splice(const_iterator pos, intrusive_list& other, const_iterator it) noexcept;
+    void reverse() noexcept { reverseLinks(end_); }
+    void sort() { sort(std::less<value_type>()); }
+    template <typename Compare>
+    void sort(Compare comp);
+    void merge(intrusive_list& other) { merge(other, std::less<value_type>()); }
+    template <typename Compare>
+    void merge(intrusive_list& other, Compare comp);
+
+private:
+    static list_links* hookOf(T& value) noexcept { return &static_cast<list_hook&>(value.*Hook); }
+    static T& valueOf(list_links* links) noexcept;
+    static list_links* mutableLinks(const list_links* links) noexcept { return const_cast<list_links*>(links); }
+
+    template <typename Compare>
+    static auto linkCompare(Compare& comp) {
+        return [&comp](list_links* first, list_links* second) { return comp(valueOf(first), valueOf(second)); };
+    }
+    // размыкает звено, чтобы is_linked() снова был false
+    static void resetLinks(list_links* links) noexcept { links->pNext = links->pPrev = nullptr; }
+    void stealLinks(intrusive_list& other) noexcept;
+    void countIn(std::ptrdiff_t delta) noexcept {
+        if constexpr (!kAutoUnlink)
+            size_ = static_cast<size_type>(static_cast<std::ptrdiff_t>(size_) + delta);
+    }
+
+    list_links end_{&end_, &end_};
+    // для auto_unlink_list_hook не ведётся: объект может уйти сам
+    size_type size_ = 0;
+};
+
+// итератор — указатель на звено; end() — страж
+template <typename T, auto Hook>
+template <bool Const>
+class intrusive_list<T, Hook>::IntrusiveIterator {
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<Const, const T*, T*>::type;
+    using reference = typename std::conditional<Const, const T&, T&>::type;
+    using links_pointer = typename std::conditional<Const, const list_links*, list_links*>::type;
+
+    IntrusiveIterator() = default;
+    explicit IntrusiveIterator(links_pointer links) : current_(links) {}
+    // iterator -> const_iterator
+    template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+    IntrusiveIterator(const IntrusiveIterator<OtherConst>& other) : current_(other.current_) {}
+
+    reference operator*() const { return valueOf(mutableLinks(current_)); }
+    pointer operator->() const { return &**this; }
+
+    IntrusiveIterator& operator++() {
+        current_ = current_->pNext;
+        return *this;
+    }
+    IntrusiveIterator operator++(int) {
+        IntrusiveIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    IntrusiveIterator& operator--() {
+        current_ = current_->pPrev;
+        return *this;
+    }
+    IntrusiveIterator operator--(int) {
+        IntrusiveIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const IntrusiveIterator& other) const { return current_ == other.current_; }
+    bool operator!=(const IntrusiveIterator& other) const { return !(*this == other); }
+
+private:
+    template <bool>
+    friend class IntrusiveIterator;
+    friend class intrusive_list;
+
+    links_pointer current_ = nullptr;
+};
+
+// ------------------------------------- звено и объект -------------------------------------
+
+// смещение звена внутри T берётся у неактивного члена union: объект не
+// создаётся, а компилятор сворачивает вычисление в константу
+template <typename T, auto Hook>
+T& intrusive_list<T, Hook>::valueOf(list_links* links) noexcept {
+    union Probe {
+        Probe() {}
+        ~Probe() {}
+        char bytes[sizeof(T)];
+        T value;
+    } probe;
+    std::ptrdiff_t offset = reinterpret_cast<char*>(&(probe.value.*Hook)) - probe.bytes;
+    return *reinterpret_cast<T*>(reinterpret_cast<char*>(static_cast<list_hook*>(links)) - offset);
+}
+
+template <typename T, auto Hook>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::size() const noexcept {
+    if constexpr (kAutoUnlink) {
+        size_type count = 0;
+        for (const list_links* current = end_.pNext; current != &end_; current = current->pNext)
+            ++count;
+        return count;
+    } else {
+        return size_;
+    }
+}
+
+// ------------------------------------- модификаторы -------------------------------------
+
+template <typename T, auto Hook>
+intrusive_list<T, Hook>& intrusive_list<T, Hook>::operator=(intrusive_list&& other) noexcept {
+    if (this != &other) {
+        clear();
+        stealLinks(other);
+    }
+    return *this;
+}
+
+template <typename T, auto Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(const_iterator pos, reference value) noexcept {
+    list_links* links = hookOf(value);
+    linkBefore(mutableLinks(pos.current_), links);
+    countIn(1);
+    return iterator(links);
+}
+
+template <typename T, auto Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const_iterator pos) {
+    list_links* links = mutableLinks(pos.current_);
+    if (links == &end_)
+        throw std::out_of_range("Iterator out of range");
+    list_links* next = links->pNext;
+    unlinkNode(links);
+    resetLinks(links);
+    countIn(-1);
+    return iterator(next);
+}
+
+template <typename T, auto Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const_iterator first, const_iterator last) noexcept {
+    list_links* current = mutableLinks(first.current_);
+    list_links* stop = mutableLinks(last.current_);
+    if (current == stop)
+        return iterator(stop);
+    current->pPrev->pNext = stop;
+    stop->pPrev = current->pPrev;
+    while (current != stop) {
+        list_links* next = current->pNext;
+        resetLinks(current);
+        countIn(-1);
+        current = next;
+    }
+    return iterator(stop);
+}
+
+template <typename T, auto Hook>
+void intrusive_list<T, Hook>::pop_back() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    erase(--end());
+}
+
+template <typename T, auto Hook>
+void intrusive_list<T, Hook>::pop_front() {
+    if (empty())
+        throw std::out_of_range("List is empty");
+    erase(begin());
+}
+
+// каждому звену сбрасываются связи, иначе объекты считали бы себя в списке
+template <typename T, auto Hook>
+void intrusive_list<T, Hook>::clear() noexcept {
+    erase(begin(), end());
+}
+
+// забирает звенья other в пустой this; соседние звенья перевешиваются на свой страж
+template <typename T, auto Hook>
+void intrusive_list<T, Hook>::stealLinks(intrusive_list& other) noexcept {
+    if (other.empty())
+        return;
+    end_ = other.end_;
+    size_ = other.size_;
+    end_.pNext->pPrev = &end_;
+    end_.pPrev->pNext = &end_;
+    other.end_.pNext = other.end_.pPrev = &other.end_;
+    other.size_ = 0;
+}
+
+template <typename T, auto Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list& other) noexcept {
+    if (this == &other)
+        return;
+    intrusive_list temp(std::move(other));
+    other.stealLinks(*this);
+    stealLinks(temp);
+}
+
+template <typename T, auto Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list& other) noexcept {
+    if (this == &other || other.empty())
+        return;
+    size_type moved = other.size_;
+    linkChainBefore(mutableLinks(pos.current_), other.end_.pNext, other.end_.pPrev);
+    other.end_.pNext = other.end_.pPrev = &other.end_;
+    other.size_ = 0;
+    countIn(static_cast<std::ptrdiff_t>(moved));
+}
+
+// основа LRU: перестановка элемента в голову — splice(begin(), *this, it)
+template <typename T, auto Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list& other, const_iterator it) noexcept {
+    list_links* links = mutableLinks(it.current_);
+    list_links* posLinks = mutableLinks(pos.current_);
+    if (links == posLinks || links->pNext == posLinks)
+        return;
+    unlinkNode(links);
+    linkBefore(posLinks, links);
+    other.countIn(-1);
+    countIn(1);
+}
+
+template <typename T, auto Hook>
+template <typename Compare>
+void intrusive_list<T, Hook>::sort(Compare comp) {
+    if (end_.pNext == end_.pPrev)
+        return;
+    sortLinks(end_, linkCompare(comp));
+}
+
+template <typename T, auto Hook>
+template <typename Compare>
+void intrusive_list<T, Hook>::merge(intrusive_list& other, Compare comp) {
+    if (this == &other || other.empty())
+        return;
+    size_type moved = other.size_;
+    mergeLinks(end_, other.end_, linkCompare(comp));
+    other.size_ = 0;
+    countIn(static_cast<std::ptrdiff_t>(moved));
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_INTRUSIVE_LIST_H
@@ -1,11 +1,25 @@
+#ifndef S21_CONTAINERS_LIST_H
+#define S21_CONTAINERS_LIST_H
+
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
 #include <limits>
+#include <type_traits>
 #include <typeinfo>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "execution.h"
+#include "list_links.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
 public:
     // -------------------  обьявление итератора -------------------
@@ -18,42 +32,98 @@ public:
     using iterator = ListIterator;
     using const_iterator = ListConstIterator;
     using size_type = size_t;
+    using allocator_type = Allocator;
 
     // -------------------  конструкторы и деструкторы -------------------
     list();
+    explicit list(const allocator_type& alloc);
     list(size_type n);
+    list(size_type n, const_reference value);
+    // целые типы уходят в list(n, value), а не сюда
+    template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    list(InputIt first, InputIt last);
     list(std::initializer_list<value_type> const &items);
     list(const list &l);
     list(list &&l);
     ~list();
 
+    list& operator=(const list &l);
     list& operator=(list &&l);
 
 
     // -------------------  методы для работы со списком -------------------
-    bool empty() {return !size_;} // checks whether the container is empty
-    size_type size() {return size_;}
-    size_type max_size() { return std::numeric_limits<size_type>::max();}
+    bool empty() const noexcept { return !size_; } // checks whether the container is empty
+    size_type size() const noexcept { return size_; }
+    size_type max_size() const noexcept { return std::numeric_limits<size_type>::max(); }
+    allocator_type get_allocator() const { return allocator_type(alloc_); }
 
     void push_back(const value_type& data);
+    void push_back(value_type&& data);
     void show_list();
-    reference operator[](size_type index);
+    reference operator[](size_type index); // O(1) for sequential indices, otherwise walks from the nearest end
     void pop_front();
     void pop_back();
     void push_front(const value_type& data);
+    void push_front(value_type&& data);
     void clear();
+    // assign переиспользует узлы: значения присваиваются поверх, лишние
+    // узлы освобождаются, недостающие достраиваются цепочкой
+    void assign(size_type n, const_reference value);
+    template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<value_type> items) { assign(items.begin(), items.end()); }
+    void resize(size_type n);
+    void resize(size_type n, const_reference value);
     iterator insert(iterator pos, const_reference value); // inserts element into concrete pos and returns the iterator that points to the new element
-    void erase(iterator pos); //erases element at pos
+    iterator insert(iterator pos, value_type&& value);
+    // вставки пачкой: при исключении список не меняется
+    iterator insert(iterator pos, size_type n, const_reference value);
+    template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    iterator insert(iterator pos, InputIt first, InputIt last);
+    template <typename... Args>
+    iterator emplace(iterator pos, Args&&... args); // constructs element in place before pos
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    template <typename... Args>
+    reference emplace_front(Args&&... args);
+    iterator erase(iterator pos); //erases element at pos and returns the iterator that points to the next element
+    iterator erase(iterator first, iterator last); //erases elements in [first, last)
     reference front() noexcept { return *begin(); }; //access the first element
     const_reference front() const noexcept { return *begin(); }
-    reference back() noexcept { return *(--begin()); }
-    const_reference back() const noexcept { return *(--begin()); }
+    reference back() noexcept { return *(--end()); }
+    const_reference back() const noexcept { return *(--end()); }
     void swap(list& other);
     void splice(ListConstIterator pos, list& other);
+    // узлы перевешиваются без выделения памяти и копирования; other может
+    // быть и этим же списком. Как и в std::list, splice и merge требуют
+    // равных аллокаторов: узел освобождает тот список, куда он перевешен
+    void splice(ListConstIterator pos, list& other, ListConstIterator it);
+    void splice(ListConstIterator pos, list& other, ListConstIterator first, ListConstIterator last); // O(k) to count nodes
+    void splice(ListConstIterator pos, list& other, ListConstIterator first, ListConstIterator last, size_type count);
     void reverse();
-    void unique();
+    // unique, remove и remove_if возвращают число удалённых элементов
+    size_type unique();
+    template <typename BinaryPredicate>
+    size_type unique(BinaryPredicate pred);
+    size_type remove(const_reference value);
+    template <typename UnaryPredicate>
+    size_type remove_if(UnaryPredicate pred);
     void sort();
+    template <typename Compare>
+    void sort(Compare comp);
+    // seq — то же, что sort(comp). par и par_unseq режут список на куски по
+    // числу потоков пула, сортируют их параллельно и сливают деревом; comp
+    // вызывается из разных потоков одновременно
+    template <typename ExecutionPolicy, typename Compare,
+              typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+    void sort(ExecutionPolicy&& policy, Compare comp);
     void merge(list& other);
+    template <typename Compare>
+    void merge(list& other, Compare comp);
+    template <typename InputIt>
+    void merge_all(InputIt first, InputIt last);
+    template <typename InputIt, typename Compare>
+    void merge_all(InputIt first, InputIt last, Compare comp);
     template <typename... Args>
     iterator insert_many(iterator pos, Args&&... args);
     template <typename... Args>
@@ -69,36 +139,103 @@ public:
 
 
 private:
+    // связи узла. Сам список хранит такой узел-страж end_ без данных:
+    // end_.pNext — голова, end_.pPrev — хвост, пустой список замкнут на end_.
+    // Поэтому у любого узла всегда есть соседи и вставка/удаление идут без
+    // проверок на голову и хвост
+    using NodeBase = list_links;
     class Node;
 
+    // узлы выделяются аллокатором, перепривязанным с T на Node
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    template <typename... Args>
+    Node* createNode(NodeBase* pNext, NodeBase* pPrev, Args&&... args);
+    void destroyNode(NodeBase* node);
+    static reference valueOf(NodeBase* node) { return static_cast<Node*>(node)->data; }
+
+    // работа со стражем
+    void resetSentinel() {
+        end_.pNext = end_.pPrev = &end_;
+        forgetCursor();
+    }
+    void relinkSentinel();
+    void stealNodes(list& other);
+
+    // сортировка и слияние идут над связями из list_links.h, сравнение
+    // значений оборачивается в сравнение узлов
+    template <typename Compare>
+    static auto linkCompare(Compare& comp) {
+        return [&comp](NodeBase* first, NodeBase* second) { return comp(valueOf(first), valueOf(second)); };
+    }
+    NodeBase* detachChain();
+    // кусок короче этого выгоднее досортировать в одном потоке
+    static constexpr size_type kParallelSortGrain = size_type(1) << 14;
+    template <typename Compare>
+    void sortParallel(thread_pool& pool, Compare comp);
+    template <typename Drop>
+    size_type unlinkIf(Drop drop);
+    size_type destroyChain(NodeBase* head);
+
+    // цепочка узлов, построенная в стороне от списка: pNext до nullptr,
+    // pPrev расставлены. В список она вшивается одним linkChainBefore
+    struct Chain {
+        NodeBase* head = nullptr;
+        NodeBase* tail = nullptr;
+        size_type count = 0;
+    };
+    template <typename... Args>
+    Chain buildChainOf(size_type n, const Args&... args);
+    template <typename InputIt>
+    Chain buildChainFrom(InputIt first, InputIt last);
+    template <typename... Args>
+    void appendToChain(Chain& chain, Args&&... args);
+    NodeBase* linkChain(NodeBase* pos, const Chain& chain);
+    void eraseToEnd(NodeBase* from);
+
+    // курсор — узел последнего обращения по индексу и его номер. Вставка
+    // и удаление на концах сдвигают номер, всё, что перевешивает узлы в
+    // середине, курсор сбрасывает
+    void forgetCursor() noexcept { cursorNode_ = nullptr; }
+
     size_type size_{};
-    Node* head_{};
-    Node* tail_{};
+    NodeBase end_{&end_, &end_};
+    node_allocator alloc_;
+    NodeBase* cursorNode_ = nullptr;
+    size_type cursorIndex_ = 0;
 };
 
 // --------------------------------------- классы ------------------------------------------
-template <typename T>
-class list<T>::Node {
+template <typename T, typename Allocator>
+class list<T, Allocator>::Node : public NodeBase {
     public:
         value_type data;
-        Node* pNext;
-        Node* pPrev;
 
-        Node(const value_type& data = value_type(), Node* pNext = nullptr, Node* pPrev = nullptr) : data(data), pNext(pNext), pPrev(pPrev) {}
+        // значение создаётся прямо в узле из аргументов
+        template <typename... Args>
+        Node(NodeBase* pNext, NodeBase* pPrev, Args&&... args) : NodeBase{pNext, pPrev}, data(std::forward<Args>(args)...) {}
 };
 
 
-template <typename T>
-class list<T>::ListIterator {
+// итератор — это один указатель на узел: ++ и -- просто идут по pNext/pPrev,
+// --end() попадает в хвост без обращения к списку
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListIterator {
 public:
-    ListIterator(Node * node = nullptr, list<T>& pList = nullptr) : current(node), pList(pList) {}
-    ListIterator(const ListIterator& other) : current(other.current), pList(other.pList) {}
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    ListIterator(NodeBase* node = nullptr) : current(node) {}
+    ListIterator(const ListIterator& other) : current(other.current) {}
 
-    T& operator*() { return current->data; }
+    T& operator*() const { return static_cast<Node*>(current)->data; }
 
     ListIterator& operator++() {
-        if (this->pList.size_ != 0)
-            current = current->pNext;
+        current = current->pNext;
         return *this;
     }
 
@@ -109,28 +246,20 @@ public:
         return temp;
     }
 
-  
     ListIterator& operator--() {
-        if (current == pList.head_)
-            current = pList.tail_;
-        else if (current!=nullptr)
-            current = current->pPrev;
-        else 
-            current = pList.tail_;
+        current = current->pPrev;
         return *this;
     }
-    
+
     // постфиксный
-    ListIterator& operator--(int) {
+    ListIterator operator--(int) {
         ListIterator temp = *this;
         --(*this);
         return temp;
     }
 
     ListIterator& operator=(const ListIterator& other) {
-        if (this != &other) { 
-            this->current = other.current;
-        }
+        this->current = other.current;
         return *this;
     }
 
@@ -139,27 +268,27 @@ public:
     bool operator!=(const ListIterator& other) const { return !(current == other.current); }
 
     // текущий узел, на который указывает итератор
-    Node * current;
-    // костыль для итератора
-    list<T>& pList;
+    NodeBase * current;
 };
 
-template <typename T>
-class list<T>::ListConstIterator {
-private:
-
-
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListConstIterator {
 public:
-    ListConstIterator(const Node* node, const list<T>& pList) : current(node), pList(pList) {}
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
 
+    ListConstIterator(const NodeBase* node = nullptr) : current(node) {}
 
-    const T& operator*() const { return current->data; }
-    ListConstIterator(const ListIterator& iter) : current(iter.current), pList(iter.pList) {}
+
+    const T& operator*() const { return static_cast<const Node*>(current)->data; }
+    ListConstIterator(const ListIterator& iter) : current(iter.current) {}
 
 
     ListConstIterator& operator++() {
-        if (this->pList.size_ != 0)
-            current = current->pNext;
+        current = current->pNext;
         return *this;
     }
 
@@ -170,21 +299,16 @@ public:
         return temp;
     }
 
-    const Node* getCurrent() const { return current; }
+    const NodeBase* getCurrent() const { return current; }
 
 
     ListConstIterator& operator--() {
-        if (current == pList.head_)
-            current = pList.tail_;
-        else if (current!=nullptr)
-            current = current->pPrev;
-        else 
-            current = pList.tail_;
+        current = current->pPrev;
         return *this;
     }
-    
 
-    ListConstIterator& operator--(int) {
+
+    ListConstIterator operator--(int) {
         ListConstIterator temp = *this;
         --(*this);
         return temp;
@@ -195,387 +319,815 @@ public:
     bool operator!=(const ListConstIterator& other) const { return !(*this == other); }
 
 
-    const Node * current;
-    const list<T>& pList;
+    const NodeBase * current;
 };
 
 
 // ------------------------------------- для итератора -------------------------------------
 
 
-template <typename T>
-typename list<T>::ListIterator list<T>::begin() {
-    return ListIterator(head_, *this);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::begin() {
+    return ListIterator(end_.pNext);
 }
 
 
-template <typename T>
-typename list<T>::ListIterator list<T>::end() {
-    return ListIterator(nullptr, *this);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::end() {
+    return ListIterator(&end_);
 }
 
-template <typename T>
-typename list<T>::ListConstIterator list<T>::begin() const{
-    return ListConstIterator(head_, *this);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListConstIterator list<T, Allocator>::begin() const{
+    return ListConstIterator(end_.pNext);
 }
 
 
-template <typename T>
-typename list<T>::ListConstIterator list<T>::end() const{
-    return ListConstIterator(nullptr, *this);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListConstIterator list<T, Allocator>::end() const{
+    return ListConstIterator(&end_);
 }
 
 
 
 // ------------------------------------- конструкторы и деструкторы list -------------------------------------
 
-template <typename T>
-list<T>::list() : size_(0), head_(nullptr), tail_(nullptr) {}
+template <typename T, typename Allocator>
+list<T, Allocator>::list() : size_(0) {}
+
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const allocator_type& alloc) : size_(0), alloc_(alloc) {}
 
-template <typename T>
-list<T>::~list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::~list() {
     clear();
 }
 
-template <typename T>
-list<T>::list(size_type n) : size_(0), head_(nullptr), tail_(nullptr) {
-    for (size_type i = 0; i < n; ++i) {
-        push_back(T{});
-    }
+// конструкторы строят все узлы одной цепочкой и вшивают её разом: без
+// обновления размера, курсора и соседей на каждом элементе
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type n) : size_(0) {
+    linkChain(&end_, buildChainOf(n));
 }
 
-template <typename T>
-list<T>::list(std::initializer_list<value_type> const &items) : size_(0), head_(nullptr), tail_(nullptr) {
-    
-    for (const T& item : items) {
-        push_back(item);
-    }
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type n, const_reference value) : size_(0) {
+    linkChain(&end_, buildChainOf(n, value));
 }
 
-template <typename T>
-list<T>::list(const list &l) {
-    size_ = 0;
-    
-    for (auto it = l.begin(); it != l.end(); ++it) {
-        push_back(*it);
-    }
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+list<T, Allocator>::list(InputIt first, InputIt last) : size_(0) {
+    linkChain(&end_, buildChainFrom(first, last));
 }
 
-template <typename T>
-list<T>::list(list &&l) {
-    size_ = l.size_;
-    head_ = l.head_;
-    tail_ = l.tail_;
-    l.size_ = 0;
-    l.head_ = nullptr;
-    l.tail_ = nullptr;
+template <typename T, typename Allocator>
+list<T, Allocator>::list(std::initializer_list<value_type> const &items) : size_(0) {
+    linkChain(&end_, buildChainFrom(items.begin(), items.end()));
+}
+
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list &l)
+    : size_(0), alloc_(node_traits::select_on_container_copy_construction(l.alloc_)) {
+    linkChain(&end_, buildChainFrom(l.begin(), l.end()));
+}
+
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list &&l) : alloc_(l.alloc_) {
+    stealNodes(l);
 }
 
 // --------------------------------------- методы -------------------------------------
-template <typename T>
-void list<T>::swap(list& other) {
+// страж лежит внутри объекта, поэтому после обмена узлы нужно перевесить
+// на свой end_
+template <typename T, typename Allocator>
+void list<T, Allocator>::swap(list& other) {
     if (this != &other) {
-      std::swap(head_, other.head_);
+      std::swap(end_, other.end_);
       std::swap(size_, other.size_);
-      std::swap(tail_, other.tail_);
-    }
-}
-
-template <typename T>
-void list<T>::erase(iterator pos) {
-    iterator it = this->begin();
-    iterator last = this->end();
-    --last;
-    if (it == pos)
-        pop_front();
-    else if (pos == last) 
-        pop_back();
-    else {
-        Node *current = head_;
-        Node *tmp;
-        --pos;
-        while (it != pos) {
-            current = current->pNext;
-            ++it;
-        }
-        tmp = current->pNext;
-        tmp->pNext->pPrev = current;
-        current->pNext = tmp->pNext;
-        delete tmp;
-        size_--;
-    }
-}
-
-template <typename T>
-typename list<T>::ListIterator list<T>::insert(ListIterator pos, const_reference value) {
-    Node* newNode = new Node(value);
-    Node* current = head_;
-    iterator it = this->begin();
-    // если вначале 
-    if (it == pos) {
-        push_front(value);
-        --it;
-    } // если в конце
-    else if (pos == this->end()) {
-        push_back(value);
-        --it;
-    } // если по середине
-    else {
-        --pos;
-        while (it != pos){
-            ++it;
-            current = current->pNext;
-        }
-        newNode->pNext = current->pNext;
-        current->pNext = newNode;
-        newNode->pPrev = current;
-        newNode->pNext->pPrev = newNode;
-        ++it;
-        size_++;
+      relinkSentinel();
+      other.relinkSentinel();
+      if (node_traits::propagate_on_container_swap::value)
+        std::swap(alloc_, other.alloc_);
+    }
+}
+
+// узел pos.current вынимается из цепочки напрямую, без прохода от головы — O(1)
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::erase(iterator pos) {
+    NodeBase* posNode = pos.current;
+    if (posNode == &end_)
+        throw std::out_of_range("Iterator out of range");
+    NodeBase* next = posNode->pNext;
+    NodeBase* prev = posNode->pPrev;
+    if (cursorNode_ != nullptr) {
+        if (posNode == cursorNode_)
+            forgetCursor();
+        else if (posNode == end_.pNext)
+            --cursorIndex_;
+        else if (posNode != end_.pPrev)
+            forgetCursor();
     }
-    return it;
+    prev->pNext = next;
+    next->pPrev = prev;
+    destroyNode(posNode);
+    size_--;
+    return ListIterator(next);
 }
 
-template <typename T>
-list<T>& list<T>::operator=(list &&l)  {
+// диапазон вынимается из кольца целиком и освобождается одной цепочкой
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::erase(iterator first, iterator last) {
+    if (first == last)
+        return last;
+    NodeBase* head = first.current;
+    NodeBase* stop = last.current;
+    NodeBase* tail = stop->pPrev;
+    head->pPrev->pNext = stop;
+    stop->pPrev = head->pPrev;
+    tail->pNext = nullptr;
+    size_ -= destroyChain(head);
+    forgetCursor();
+    return last;
+}
+
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::insert(ListIterator pos, const_reference value) {
+    return emplace(pos, value);
+}
+
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::insert(ListIterator pos, value_type&& value) {
+    return emplace(pos, std::move(value));
+}
+
+// новый узел подшивается перед pos.current, без прохода от головы — O(1).
+// все вставки (push_*, insert, insert_many) сводятся к emplace
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::emplace(ListIterator pos, Args&&... args) {
+    NodeBase* posNode = pos.current;
+    NodeBase* prev = posNode->pPrev;
+    Node* newNode = createNode(posNode, prev, std::forward<Args>(args)...);
+    // вставка в хвост номеров не меняет, в голову — сдвигает их на один
+    if (cursorNode_ != nullptr && posNode != &end_) {
+        if (posNode == end_.pNext)
+            ++cursorIndex_;
+        else
+            forgetCursor();
+    }
+    prev->pNext = newNode;
+    posNode->pPrev = newNode;
+    size_++;
+    return ListIterator(newNode);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+// строгая гарантия. Если присваивание T не бросает, узлы this
+// переиспользуются: сначала в стороне строятся недостающие узлы (только
+// это и может бросить), потом значения перезаписываются на месте, лишние
+// узлы освобождаются. Иначе копия строится целиком и подменяет старые узлы
+template <typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(const list &l) {
+    if (this == &l) return *this;
+    const bool adoptAllocator =
+        node_traits::propagate_on_container_copy_assignment::value && !(alloc_ == l.alloc_);
+    if constexpr (std::is_nothrow_copy_assignable<value_type>::value) {
+        if (!adoptAllocator) {
+            // начало хвоста l, которому не хватает узлов, ищется с ближнего конца
+            Chain extra;
+            if (l.size_ > size_) {
+                const NodeBase* from = l.end_.pNext;
+                if (size_ <= l.size_ - size_) {
+                    for (size_type i = 0; i < size_; ++i)
+                        from = from->pNext;
+                } else {
+                    from = &l.end_;
+                    for (size_type i = size_; i < l.size_; ++i)
+                        from = from->pPrev;
+                }
+                extra = buildChainFrom(ListConstIterator(from), l.end());
+            }
+            NodeBase* current = end_.pNext;
+            const NodeBase* source = l.end_.pNext;
+            for (; current != &end_ && source != &l.end_; current = current->pNext, source = source->pNext)
+                valueOf(current) = static_cast<const Node*>(source)->data;
+            eraseToEnd(current);
+            linkChain(&end_, extra);
+            return *this;
+        }
+    }
+    // аллокатор узлов копируется как есть: через allocator_type и rebind
+    // пул мог бы оказаться другим
+    list copy;
+    copy.alloc_ = adoptAllocator ? l.alloc_ : alloc_;
+    copy.linkChain(&copy.end_, copy.buildChainFrom(l.begin(), l.end()));
     clear();
-    size_ = l.size_;
-    head_ = l.head_;
-    tail_ = l.tail_;
-    l.size_ = 0;
-    l.head_ = nullptr;
-    l.tail_ = nullptr;
+    alloc_ = copy.alloc_;
+    stealNodes(copy);
     return *this;
 }
 
-template <typename T>
-void list<T>::push_back(const value_type& data) {
-    Node* newNode = new Node(data);
-    if (head_ == nullptr) {
-        head_ = newNode;
-        tail_ = newNode;
-    } else {
-        tail_->pNext = newNode;
-        newNode->pPrev=tail_;
-        tail_ = newNode;
+// узлы l можно забрать, только если их сможет освободить наш аллокатор,
+// иначе элементы переносятся по одному
+template <typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(list &&l)  {
+    if (this == &l) return *this;
+    clear();
+    if (node_traits::propagate_on_container_move_assignment::value)
+        alloc_ = l.alloc_;
+    else if (!(alloc_ == l.alloc_)) {
+        for (auto it = l.begin(); it != l.end(); ++it)
+            push_back(std::move(*it));
+        l.clear();
+        return *this;
     }
-    size_++;
+    stealNodes(l);
+    return *this;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(const value_type& data) {
+    emplace(end(), data);
 }
 
-template <typename T>
-void list<T>::show_list() {
-    Node* current = head_;
-    if (current == nullptr)
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(value_type&& data) {
+    emplace(end(), std::move(data));
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::show_list() {
+    if (size_ == 0)
         std::cout << "empty list\n";
-    while (current != nullptr) {
-        std::cout << current->data << std::endl;
-        current = current->pNext;
-    }
+    for (auto it = begin(); it != end(); ++it)
+        std::cout << *it << std::endl;
 }
 
 
 
-template <typename T>
-void list<T>::pop_front() {
-    if (head_ != nullptr) {
-        Node * temp = head_;
-        if (head_->pNext != nullptr)
-            head_ = head_->pNext;
-        head_->pPrev = nullptr;
-        delete temp;
-    } else {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_front() {
+    if (size_ == 0)
         throw std::out_of_range("List is empty");
-    }
-    size_--;
+    erase(begin());
 }
 
-template <typename T>
-void list<T>::pop_back() {
-    if (tail_ != nullptr) {
-        Node * temp = tail_;
-        if (tail_->pPrev != nullptr)
-            tail_ = tail_->pPrev;
-        tail_->pNext = nullptr;
-        delete temp;
-    } else {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_back() {
+    if (size_ == 0)
         throw std::out_of_range("List is empty");
-    }
-    size_--;
+    erase(ListIterator(end_.pPrev));
 }
 
-template <typename T>
-void list<T>::push_front(const value_type& data) {
-    Node* newNode = new Node(data);
-    if (head_ == nullptr) {
-        head_ = newNode;
-        tail_ = newNode;
-    } else {
-        newNode->pNext = head_;
-        head_->pPrev = newNode;
-        head_ = newNode;
-    }
-    size_++;
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(const value_type& data) {
+    emplace(begin(), data);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(value_type&& data) {
+    emplace(begin(), std::move(data));
 }
 
 
-template <typename T>
-void list<T>::clear() {
-    Node* current = head_;
-    while (current != nullptr) {
-        Node* next = current->pNext;
-        delete current;
+template <typename T, typename Allocator>
+void list<T, Allocator>::clear() {
+    NodeBase* current = end_.pNext;
+    while (current != &end_) {
+        NodeBase* next = current->pNext;
+        destroyNode(current);
         current = next;
     }
-    head_ = nullptr;
-    tail_ = nullptr;
+    resetSentinel();
     size_ = 0;
 }
 
+template <typename T, typename Allocator>
+void list<T, Allocator>::assign(size_type n, const_reference value) {
+    NodeBase* current = end_.pNext;
+    for (; n != 0 && current != &end_; --n, current = current->pNext)
+        valueOf(current) = value;
+    eraseToEnd(current);
+    linkChain(&end_, buildChainOf(n, value));
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+void list<T, Allocator>::assign(InputIt first, InputIt last) {
+    NodeBase* current = end_.pNext;
+    for (; first != last && current != &end_; ++first, current = current->pNext)
+        valueOf(current) = *first;
+    eraseToEnd(current);
+    linkChain(&end_, buildChainFrom(first, last));
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::resize(size_type n) {
+    if (n >= size_) {
+        linkChain(&end_, buildChainOf(n - size_));
+        return;
+    }
+    NodeBase* from = &end_;
+    for (size_type i = size_; i > n; --i)
+        from = from->pPrev;
+    eraseToEnd(from);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::resize(size_type n, const_reference value) {
+    if (n >= size_) {
+        linkChain(&end_, buildChainOf(n - size_, value));
+        return;
+    }
+    NodeBase* from = &end_;
+    for (size_type i = size_; i > n; --i)
+        from = from->pPrev;
+    eraseToEnd(from);
+}
+
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::insert(iterator pos, size_type n, const_reference value) {
+    return ListIterator(linkChain(pos.current, buildChainOf(n, value)));
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::insert(iterator pos, InputIt first, InputIt last) {
+    return ListIterator(linkChain(pos.current, buildChainFrom(first, last)));
+}
+
+// ------------------------------------- работа с узлами -------------------------------------
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::Node* list<T, Allocator>::createNode(NodeBase* pNext, NodeBase* pPrev, Args&&... args) {
+    Node* node = node_traits::allocate(alloc_, 1);
+    try {
+        node_traits::construct(alloc_, node, pNext, pPrev, std::forward<Args>(args)...);
+    } catch (...) {
+        node_traits::deallocate(alloc_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+// если конструктор элемента бросит, построенная часть освобождается,
+// а список, для которого строили, ещё не тронут
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::Chain list<T, Allocator>::buildChainOf(size_type n, const Args&... args) {
+    Chain chain;
+    try {
+        for (; chain.count < n;)
+            appendToChain(chain, args...);
+    } catch (...) {
+        destroyChain(chain.head);
+        throw;
+    }
+    return chain;
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt>
+typename list<T, Allocator>::Chain list<T, Allocator>::buildChainFrom(InputIt first, InputIt last) {
+    Chain chain;
+    try {
+        for (; first != last; ++first)
+            appendToChain(chain, *first);
+    } catch (...) {
+        destroyChain(chain.head);
+        throw;
+    }
+    return chain;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+void list<T, Allocator>::appendToChain(Chain& chain, Args&&... args) {
+    Node* node = createNode(nullptr, chain.tail, std::forward<Args>(args)...);
+    if (chain.tail == nullptr)
+        chain.head = node;
+    else
+        chain.tail->pNext = node;
+    chain.tail = node;
+    ++chain.count;
+}
+
+// вшивает цепочку перед pos и возвращает первый её узел (pos, если пусто).
+// Вставка в хвост номеров не меняет, в голову — сдвигает их на длину цепочки
+template <typename T, typename Allocator>
+typename list<T, Allocator>::NodeBase* list<T, Allocator>::linkChain(NodeBase* pos, const Chain& chain) {
+    if (chain.count == 0)
+        return pos;
+    if (cursorNode_ != nullptr && pos != &end_) {
+        if (pos == end_.pNext)
+            cursorIndex_ += chain.count;
+        else
+            forgetCursor();
+    }
+    linkChainBefore(pos, chain.head, chain.tail);
+    size_ += chain.count;
+    return chain.head;
+}
+
+// освобождает узлы от from до конца; курсор перед from остаётся верным
+template <typename T, typename Allocator>
+void list<T, Allocator>::eraseToEnd(NodeBase* from) {
+    if (from == &end_)
+        return;
+    NodeBase* tail = end_.pPrev;
+    from->pPrev->pNext = &end_;
+    end_.pPrev = from->pPrev;
+    tail->pNext = nullptr;
+    size_ -= destroyChain(from);
+    if (cursorNode_ != nullptr && cursorIndex_ >= size_)
+        forgetCursor();
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::destroyNode(NodeBase* node) {
+    Node* valueNode = static_cast<Node*>(node);
+    node_traits::destroy(alloc_, valueNode);
+    node_traits::deallocate(alloc_, valueNode, 1);
+}
+
+// ------------------------------------- работа со стражем -------------------------------------
+
+// после копирования end_ соседние узлы ещё смотрят на чужой страж
+template <typename T, typename Allocator>
+void list<T, Allocator>::relinkSentinel() {
+    if (size_ == 0) {
+        resetSentinel();
+    } else {
+        end_.pNext->pPrev = &end_;
+        end_.pPrev->pNext = &end_;
+        forgetCursor();
+    }
+}
+
+// забирает все узлы other в пустой this за O(1)
+template <typename T, typename Allocator>
+void list<T, Allocator>::stealNodes(list& other) {
+    end_ = other.end_;
+    size_ = other.size_;
+    relinkSentinel();
+    other.resetSentinel();
+    other.size_ = 0;
+}
+
 // --------------------------------- определение операторов ------------------------------------
-template <typename T>
-T& list<T>::operator[](size_type index) {
+// идёт от ближайшей из трёх точек: головы, хвоста или курсора прошлого
+// обращения. Проход l[0], l[1], ... делает по одному шагу на обращение
+template <typename T, typename Allocator>
+T& list<T, Allocator>::operator[](size_type index) {
     if (index >= size_) {
         throw std::out_of_range("Index out of range");
     }
-    Node* current = head_;
-    while (index-- > 0) {
-        current = current->pNext;
+    NodeBase* current = end_.pNext;
+    size_type at = 0;
+    size_type distance = index;
+    if (size_ - 1 - index < distance) {
+        current = end_.pPrev;
+        at = size_ - 1;
+        distance = size_ - 1 - index;
+    }
+    if (cursorNode_ != nullptr) {
+        size_type fromCursor = index > cursorIndex_ ? index - cursorIndex_ : cursorIndex_ - index;
+        if (fromCursor < distance) {
+            current = cursorNode_;
+            at = cursorIndex_;
+        }
     }
-    return current->data;
+    for (; at < index; ++at)
+        current = current->pNext;
+    for (; at > index; --at)
+        current = current->pPrev;
+    cursorNode_ = current;
+    cursorIndex_ = index;
+    return valueOf(current);
 }
 
 
         
 // вставляет все элементы второго списка в указанную позицию первого листа, после этого второй лист зачищается
-template <typename T>
-void list<T>::splice(ListConstIterator pos, list& other) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(ListConstIterator pos, list& other) {
     if (this != &other && other.size_ != 0) {
-        Node* posNode = const_cast<Node*>(pos.getCurrent()); 
-        if (posNode == nullptr) {
-            if (this->size_ == 0) {
-                this->tail_ = other.tail_;
-                this->head_ = other.head_;
-            } else {
-                this->tail_->pNext = other.head_;
-                this->tail_ = other.tail_;
-            }
-
-        } else if (posNode == this->head_) {
-            other.tail_->pNext = this->head_;
-            this->head_->pPrev = other.tail_;
-            this->head_ = other.head_;
-
-        } else {
-            Node* before = posNode->pPrev;
-            before->pNext = other.head_;
-            other.head_->pPrev = before;
-
-            Node* after = posNode;
-            after->pPrev = other.tail_;
-            other.tail_->pNext = after;
-        }
+        NodeBase* posNode = const_cast<NodeBase*>(pos.getCurrent());
+        linkChainBefore(posNode, other.end_.pNext, other.end_.pPrev);
 
         this->size_ += other.size_;
+        forgetCursor();
 
-        other.head_ = nullptr;
-        other.tail_ = nullptr;
+        other.resetSentinel();
         other.size_ = 0;
     }
 }
 
-// меняет голову с хвостом, а также next и prev у кажого узла
-template <typename T>
-void list<T>::reverse() {
-    Node* current = head_;
-    Node* prev = nullptr;
-    Node* next = nullptr;
-    
-    while (current != nullptr) {
+// переносит узел it из other перед pos — O(1). Перенос на своё же место
+// ничего не делает
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(ListConstIterator pos, list& other, ListConstIterator it) {
+    NodeBase* posNode = const_cast<NodeBase*>(pos.getCurrent());
+    NodeBase* node = const_cast<NodeBase*>(it.getCurrent());
+    if (node == posNode || node->pNext == posNode)
+        return;
+    unlinkNode(node);
+    linkBefore(posNode, node);
+    if (this != &other) {
+        --other.size_;
+        ++size_;
+    }
+    forgetCursor();
+    other.forgetCursor();
+}
 
-        next = current->pNext;
-        
-        current->pNext = prev;
-        current->pPrev = next;
-        
+// размер other известен только через число узлов в [first, last), поэтому
+// их приходится пересчитать, если это не весь other; внутри одного списка
+// размер не меняется
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(ListConstIterator pos, list& other, ListConstIterator first, ListConstIterator last) {
+    size_type count = 0;
+    if (this != &other && first == other.begin() && last == other.end()) {
+        count = other.size_;
+    } else if (this != &other) {
+        for (ListConstIterator it = first; it != last; ++it)
+            ++count;
+    }
+    splice(pos, other, first, last, count);
+}
 
-        prev = current;
-        current = next;
+// count — число узлов в [first, last), если вызывающий его уже знает:
+// перенос — O(1). pos не должен лежать внутри [first, last)
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(ListConstIterator pos, list& other, ListConstIterator first, ListConstIterator last, size_type count) {
+    // перенос на своё же место (pos == first или pos == last) ничего не меняет
+    if (first == last || pos == first || pos == last)
+        return;
+    NodeBase* posNode = const_cast<NodeBase*>(pos.getCurrent());
+    NodeBase* head = const_cast<NodeBase*>(first.getCurrent());
+    NodeBase* stop = const_cast<NodeBase*>(last.getCurrent());
+    NodeBase* tail = stop->pPrev;
+    head->pPrev->pNext = stop;
+    stop->pPrev = head->pPrev;
+    linkChainBefore(posNode, head, tail);
+    if (this != &other) {
+        other.size_ -= count;
+        size_ += count;
     }
-    
-    tail_ = head_;
-    head_ = prev;
+    forgetCursor();
+    other.forgetCursor();
+}
+
+// меняет местами next и prev у каждого узла, включая страж —
+// так голова и хвост тоже меняются местами
+template <typename T, typename Allocator>
+void list<T, Allocator>::reverse() {
+    forgetCursor();
+    reverseLinks(end_);
 }
 
 // удаляет последовательно идущие совпадающие элементы
-template <typename T>
-void list<T>::unique() {
-    iterator begin_iterator = begin();
-    iterator end_iterator = end();
-    iterator prev_iterator = begin_iterator;
-
-    ++begin_iterator;
-    while (begin_iterator != end_iterator) {
-      if (*begin_iterator == *prev_iterator) {
-        erase(begin_iterator);
-        begin_iterator = prev_iterator;
-      } else {
-        ++prev_iterator;
-      }
-      ++begin_iterator;
-    }
-}
-
-template <typename T>
-void list<T>::sort() {
-    if (size_ <= 1) return;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::unique() {
+    return unique(std::equal_to<value_type>());
+}
+
+// узел сравнивается с предыдущим оставшимся: после выемки дубликатов
+// pPrev следующего узла уже указывает на него
+template <typename T, typename Allocator>
+template <typename BinaryPredicate>
+typename list<T, Allocator>::size_type list<T, Allocator>::unique(BinaryPredicate pred) {
+    if (size_ <= 1) return 0;
+    NodeBase* sentinel = &end_;
+    return unlinkIf([&pred, sentinel](NodeBase* node) {
+        return node->pPrev != sentinel && pred(valueOf(node->pPrev), valueOf(node));
+    });
+}
+
+// value может быть ссылкой на элемент самого списка: узлы освобождаются
+// после прохода, так что она жива до конца сравнений
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::remove(const_reference value) {
+    return unlinkIf([&value](NodeBase* node) { return valueOf(node) == value; });
+}
+
+template <typename T, typename Allocator>
+template <typename UnaryPredicate>
+typename list<T, Allocator>::size_type list<T, Allocator>::remove_if(UnaryPredicate pred) {
+    return unlinkIf([&pred](NodeBase* node) { return pred(valueOf(node)); });
+}
 
-    int swapped = 1;
-    while (swapped) {
-        swapped = 0;
-        Node* current = head_;
-        while (current != nullptr && current->pNext != nullptr) {
-            if (current->data > current->pNext->data) {
-                // обмен элементов местами
-                T temp = current->data;
-                current->data = current->pNext->data;
-                current->pNext->data = temp;
-                swapped = 1;
+// один проход: узлы, для которых drop истинно, вынимаются из кольца и
+// копятся цепочкой, а освобождаются разом в конце. Если drop бросит,
+// уже вынутые узлы всё равно освобождаются, остальные остаются в списке
+template <typename T, typename Allocator>
+template <typename Drop>
+typename list<T, Allocator>::size_type list<T, Allocator>::unlinkIf(Drop drop) {
+    NodeBase* removed = nullptr;
+    NodeBase** removedTail = &removed;
+    size_type count = 0;
+    try {
+        for (NodeBase* current = end_.pNext; current != &end_;) {
+            NodeBase* next = current->pNext;
+            if (drop(current)) {
+                unlinkNode(current);
+                current->pNext = nullptr;
+                *removedTail = current;
+                removedTail = &current->pNext;
+                ++count;
             }
-            current = current->pNext;
+            current = next;
         }
+    } catch (...) {
+        size_ -= count;
+        if (count != 0) forgetCursor();
+        destroyChain(removed);
+        throw;
+    }
+    size_ -= count;
+    if (count != 0) forgetCursor();
+    destroyChain(removed);
+    return count;
+}
+
+// освобождает цепочку узлов, связанных по pNext до nullptr, и
+// возвращает их число
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::destroyChain(NodeBase* head) {
+    size_type count = 0;
+    while (head != nullptr) {
+        NodeBase* next = head->pNext;
+        destroyNode(head);
+        head = next;
+        ++count;
+    }
+    return count;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort() {
+    sort(std::less<value_type>());
+}
+
+// восходящая сортировка слиянием: узлы только перевешиваются по pNext,
+// данные не копируются и не перемещаются. Сортировка устойчивая,
+// O(n log n), без выделения памяти
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::sort(Compare comp) {
+    if (size_ <= 1) return;
+    forgetCursor();
+    sortLinks(end_, linkCompare(comp));
+}
+
+template <typename T, typename Allocator>
+template <typename ExecutionPolicy, typename Compare, typename>
+void list<T, Allocator>::sort(ExecutionPolicy&& policy, Compare comp) {
+    if constexpr (std::is_same<typename std::decay<ExecutionPolicy>::type, execution::sequenced_policy>::value)
+        sort(comp);
+    else
+        sortParallel(policy.pool(), comp);
+}
+
+// кольцо размыкается и режется на runs цепочек почти равной длины, каждая
+// сортируется в своей задаче, затем соседние сливаются попарно, уровень
+// за уровнем. Слева всегда более ранние узлы, так что сортировка остаётся
+// устойчивой. Последнее слияние идёт в одном потоке
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::sortParallel(thread_pool& pool, Compare comp) {
+    const size_type runs = std::min(pool.concurrency(), size_ / kParallelSortGrain);
+    if (runs < 2) {
+        sort(comp);
+        return;
+    }
+    std::vector<NodeBase*> heads(runs);
+    NodeBase* current = detachLinkChain(end_);
+    forgetCursor();
+    for (size_type run = 0; run < runs; ++run) {
+        heads[run] = current;
+        const size_type length = size_ * (run + 1) / runs - size_ * run / runs;
+        for (size_type i = 1; i < length; ++i)
+            current = current->pNext;
+        NodeBase* next = current->pNext;
+        current->pNext = nullptr;
+        current = next;
     }
+    pool.parallel_for(0, runs, [&heads, &comp](size_type run) {
+        Compare local = comp;
+        auto linkComp = linkCompare(local);
+        heads[run] = sortLinkChain(heads[run], linkComp);
+    });
+    for (size_type width = 1; width < runs; width *= 2) {
+        pool.parallel_for(0, (runs + 2 * width - 1) / (2 * width), [&heads, &comp, runs, width](size_type pair) {
+            const size_type left = pair * 2 * width;
+            if (left + width >= runs)
+                return;
+            Compare local = comp;
+            auto linkComp = linkCompare(local);
+            heads[left] = mergeLinkChains(heads[left], heads[left + width], linkComp);
+        });
+    }
+    restoreLinkChain(end_, heads[0]);
+}
+
+// размыкает кольцо: возвращает узлы цепочкой по pNext, оканчивающейся
+// nullptr, и оставляет список пустым
+template <typename T, typename Allocator>
+typename list<T, Allocator>::NodeBase* list<T, Allocator>::detachChain() {
+    NodeBase* head = detachLinkChain(end_);
+    forgetCursor();
+    size_ = 0;
+    return head;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge(list& other) {
+    merge(other, std::less<value_type>());
 }
 
-template <typename T>
-void list<T>::merge(list& other) {
-    iterator it = end();
-    splice(it, other);
-    // sort();    
+// сливает два отсортированных списка за O(n + m) перевешиванием узлов,
+// при равенстве элементы this идут раньше; other после слияния пуст
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::merge(list& other, Compare comp) {
+    if (this == &other || other.size_ == 0) return;
+    size_type count = size_ + other.size_;
+    forgetCursor();
+    other.forgetCursor();
+    mergeLinks(end_, other.end_, linkCompare(comp));
+    size_ = count;
+    other.size_ = 0;
 }
 
-template <typename T>
+template <typename T, typename Allocator>
+template <typename InputIt>
+void list<T, Allocator>::merge_all(InputIt first, InputIt last) {
+    merge_all(first, last, std::less<value_type>());
+}
+
+// k-путевое слияние отсортированных списков [first, last) в this.
+// Списки сливаются сбалансированным деревом через те же разряды, что и в
+// sort, поэтому выходит O(N log k) без выделения памяти и устойчиво
+template <typename T, typename Allocator>
+template <typename InputIt, typename Compare>
+void list<T, Allocator>::merge_all(InputIt first, InputIt last, Compare comp) {
+    NodeBase* bins[kListMaxBins] = {};
+    int fill = 0;
+    size_type count = size_;
+    auto linkComp = linkCompare(comp);
+
+    if (size_ != 0)
+        pushLinkChain(bins, fill, detachChain(), linkComp);
+    for (; first != last; ++first) {
+        list& other = *first;
+        if (&other == this || other.size_ == 0) continue;
+        count += other.size_;
+        pushLinkChain(bins, fill, other.detachChain(), linkComp);
+    }
+    restoreLinkChain(end_, collapseLinkBins(bins, fill, linkComp));
+    size_ = count;
+}
+
+// каждый аргумент передаётся в emplace как есть (perfect forwarding),
+// поэтому rvalue перемещаются, а не копируются. Возвращает итератор на
+// первый вставленный элемент
+template <typename T, typename Allocator>
 template <typename... Args>
-typename list<T>::ListIterator list<T>::insert_many(iterator pos, Args&&... args) {
-  for (auto& arg : {args...}) {
-    insert(pos, arg);
-  }
-  return pos;
+typename list<T, Allocator>::ListIterator list<T, Allocator>::insert_many(iterator pos, Args&&... args) {
+  NodeBase* before = pos.current->pPrev;
+  (emplace(pos, std::forward<Args>(args)), ...);
+  return ListIterator(before->pNext);
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_back(Args&&... args){
-    iterator it = end();
-    (insert(it, std::forward<Args>(args)), ...);
+void list<T, Allocator>::insert_many_back(Args&&... args){
+    (emplace(end(), std::forward<Args>(args)), ...);
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_front(Args&&... args){
+void list<T, Allocator>::insert_many_front(Args&&... args){
     iterator it = begin();
-    (insert(it, std::forward<Args>(args)), ...);
+    (emplace(it, std::forward<Args>(args)), ...);
 }
 
 
 
 } // namespace s21
+
+#endif // S21_CONTAINERS_LIST_H
@@ -0,0 +1,154 @@
+#ifndef S21_CONTAINERS_LIST_LINKS_H
+#define S21_CONTAINERS_LIST_LINKS_H
+
+#include <utility>
+
+namespace s21 {
+
+// Связи двусвязного кольца со стражем и алгоритмы, которым нужны только
+// они: s21::list хранит такие связи в своих узлах, intrusive_list — в
+// звене, встроенном в объект. Сравнение передаётся над связями, а как из
+// связи достать значение, знает сам контейнер.
+
+struct list_links {
+    list_links* pNext;
+    list_links* pPrev;
+};
+
+// число "разрядов" для восходящего слияния: 2^64 цепочек не бывает
+constexpr int kListMaxBins = 64;
+
+// вшивает node перед pos
+inline void linkBefore(list_links* pos, list_links* node) noexcept {
+    list_links* prev = pos->pPrev;
+    node->pNext = pos;
+    node->pPrev = prev;
+    prev->pNext = node;
+    pos->pPrev = node;
+}
+
+// вынимает node из кольца, связи самого node не трогает
+inline void unlinkNode(list_links* node) noexcept {
+    node->pPrev->pNext = node->pNext;
+    node->pNext->pPrev = node->pPrev;
+}
+
+// вшивает уже вынутую цепочку [first, last] (last включительно) перед pos
+inline void linkChainBefore(list_links* pos, list_links* first, list_links* last) noexcept {
+    list_links* before = pos->pPrev;
+    before->pNext = first;
+    first->pPrev = before;
+    last->pNext = pos;
+    pos->pPrev = last;
+}
+
+// меняет местами next и prev у каждого звена, включая страж —
+// так голова и хвост тоже меняются местами
+inline void reverseLinks(list_links& sentinel) noexcept {
+    list_links* current = &sentinel;
+    do {
+        std::swap(current->pNext, current->pPrev);
+        current = current->pPrev;
+    } while (current != &sentinel);
+}
+
+// размыкает кольцо: возвращает звенья цепочкой по pNext, оканчивающейся
+// nullptr, и замыкает страж на себя
+inline list_links* detachLinkChain(list_links& sentinel) noexcept {
+    if (sentinel.pNext == &sentinel)
+        return nullptr;
+    list_links* head = sentinel.pNext;
+    sentinel.pPrev->pNext = nullptr;
+    sentinel.pNext = sentinel.pPrev = &sentinel;
+    return head;
+}
+
+// замыкает цепочку pNext обратно на страж и восстанавливает pPrev
+// одним проходом
+inline void restoreLinkChain(list_links& sentinel, list_links* head) noexcept {
+    list_links* prev = &sentinel;
+    sentinel.pNext = head;
+    for (list_links* current = head; current != nullptr; current = current->pNext) {
+        current->pPrev = prev;
+        prev = current;
+    }
+    prev->pNext = &sentinel;
+    sentinel.pPrev = prev;
+}
+
+// сливает две отсортированные цепочки (связанные только по pNext).
+// при равенстве первым идёт звено из first — это даёт устойчивость
+template <typename LinkCompare>
+list_links* mergeLinkChains(list_links* first, list_links* second, LinkCompare& comp) {
+    list_links* head = nullptr;
+    list_links** tail = &head;
+    while (first != nullptr && second != nullptr) {
+        if (comp(second, first)) {
+            *tail = second;
+            second = second->pNext;
+        } else {
+            *tail = first;
+            first = first->pNext;
+        }
+        tail = &(*tail)->pNext;
+    }
+    *tail = (first != nullptr) ? first : second;
+    return head;
+}
+
+// bins[i] хранит отсортированную цепочку из ~2^i "единиц", новая цепочка
+// переносится по разрядам как в двоичном счётчике. В bins[i] всегда более
+// ранние звенья, поэтому они идут первым аргументом слияния
+template <typename LinkCompare>
+void pushLinkChain(list_links** bins, int& fill, list_links* chain, LinkCompare& comp) {
+    int i = 0;
+    for (; i < fill && bins[i] != nullptr; ++i) {
+        chain = mergeLinkChains(bins[i], chain, comp);
+        bins[i] = nullptr;
+    }
+    bins[i] = chain;
+    if (i == fill) ++fill;
+}
+
+template <typename LinkCompare>
+list_links* collapseLinkBins(list_links** bins, int fill, LinkCompare& comp) {
+    list_links* result = nullptr;
+    for (int i = 0; i < fill; ++i)
+        result = mergeLinkChains(bins[i], result, comp);
+    return result;
+}
+
+// восходящая сортировка слиянием цепочки по pNext: звенья только
+// перевешиваются, O(n log n), устойчиво, без выделения памяти. pPrev
+// не расставляются — это делает restoreLinkChain
+template <typename LinkCompare>
+list_links* sortLinkChain(list_links* head, LinkCompare& comp) {
+    list_links* bins[kListMaxBins] = {};
+    int fill = 0;
+    while (head != nullptr) {
+        list_links* next = head->pNext;
+        head->pNext = nullptr;
+        pushLinkChain(bins, fill, head, comp);
+        head = next;
+    }
+    return collapseLinkBins(bins, fill, comp);
+}
+
+// то же для всего кольца
+template <typename LinkCompare>
+void sortLinks(list_links& sentinel, LinkCompare comp) {
+    restoreLinkChain(sentinel, sortLinkChain(detachLinkChain(sentinel), comp));
+}
+
+// сливает отсортированное кольцо other в отсортированное sentinel за
+// O(n + m); при равенстве звенья sentinel идут раньше, other остаётся пуст
+template <typename LinkCompare>
+void mergeLinks(list_links& sentinel, list_links& other, LinkCompare comp) {
+    list_links* first = detachLinkChain(sentinel);
+    list_links* second = detachLinkChain(other);
+    restoreLinkChain(sentinel, mergeLinkChains(first, second, comp));
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_LIST_LINKS_H
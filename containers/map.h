@@ -0,0 +1,168 @@
+#ifndef S21_CONTAINERS_MAP_H
+#define S21_CONTAINERS_MAP_H
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "pool_allocator.h"
+#include "tree.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Словарь поверх красно-чёрного дерева. Узлы по умолчанию берутся из
+// pool_allocator: узлы лежат плотно и вставка не ходит в общий malloc.
+// Копия словаря заводит собственный пул, поэтому словарь и его копию
+// можно менять из разных потоков; перемещённый словарь делит пул с
+// тем, куда его переместили
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = pool_allocator<std::pair<const Key, T>>>
+class map {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+
+private:
+    struct KeyOfValue {
+        const key_type& operator()(const value_type& value) const { return value.first; }
+    };
+    using tree_type = tree<key_type, value_type, KeyOfValue, Compare, Allocator>;
+
+public:
+    using iterator = typename tree_type::iterator;
+    using const_iterator = typename tree_type::const_iterator;
+    using size_type = size_t;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    map() = default;
+    explicit map(const Compare& comp, const allocator_type& alloc = allocator_type()) : tree_(comp, alloc) {}
+    map(std::initializer_list<value_type> const &items);
+    map(const map &m) = default;
+    map(map &&m) noexcept = default;
+    ~map() = default;
+
+    map& operator=(const map &m) = default;
+    map& operator=(map &&m) = default;
+
+    // -------------------  доступ к элементам -------------------
+    T& at(const Key& key); // access a specified element with bounds checking
+    const T& at(const Key& key) const;
+    T& operator[](const Key& key); // access or insert specified element
+
+    // ------------------- итераторы -------------------
+    iterator begin() noexcept { return tree_.begin(); }
+    iterator end() noexcept { return tree_.end(); }
+    const_iterator begin() const noexcept { return tree_.begin(); }
+    const_iterator end() const noexcept { return tree_.end(); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const noexcept { return tree_.empty(); }
+    size_type size() const noexcept { return tree_.size(); }
+    size_type max_size() const noexcept { return tree_.max_size(); }
+    allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept { tree_.clear(); }
+    std::pair<iterator, bool> insert(const value_type& value) { return tree_.insertUnique(value); }
+    std::pair<iterator, bool> insert(value_type&& value) { return tree_.insertUnique(std::move(value)); }
+    std::pair<iterator, bool> insert(const Key& key, const T& obj);
+    iterator insert(const_iterator hint, const value_type& value) { return tree_.emplaceHintUnique(hint, value); }
+    std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) { return tree_.emplaceUnique(std::forward<Args>(args)...); }
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args) { return tree_.emplaceHintUnique(hint, std::forward<Args>(args)...); }
+    iterator erase(const_iterator pos) { return tree_.erase(pos); }
+    iterator erase(iterator pos) { return tree_.erase(pos); }
+    iterator erase(const_iterator first, const_iterator last) { return tree_.erase(first, last); }
+    size_type erase(const Key& key) { return tree_.eraseUnique(key); }
+    void swap(map& other) noexcept { tree_.swap(other.tree_); }
+    void merge(map& other) { tree_.mergeUnique(other.tree_); } // splices nodes from another container
+    template <typename... Args>
+    vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+    // ------------------- поиск -------------------
+    iterator find(const Key& key) { return tree_.find(key); }
+    const_iterator find(const Key& key) const { return tree_.find(key); }
+    bool contains(const Key& key) const { return tree_.contains(key); }
+    size_type count(const Key& key) const { return tree_.contains(key) ? 1 : 0; }
+    iterator lower_bound(const Key& key) { return tree_.lower_bound(key); }
+    const_iterator lower_bound(const Key& key) const { return tree_.lower_bound(key); }
+    iterator upper_bound(const Key& key) { return tree_.upper_bound(key); }
+    const_iterator upper_bound(const Key& key) const { return tree_.upper_bound(key); }
+    key_compare key_comp() const { return tree_.key_comp(); }
+
+private:
+    tree_type tree_;
+};
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+map<Key, T, Compare, Allocator>::map(std::initializer_list<value_type> const &items) {
+    // отсортированный список вставляется за O(1) на элемент по подсказке end()
+    for (const value_type& item : items)
+        tree_.emplaceHintUnique(tree_.end(), item);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+T& map<Key, T, Compare, Allocator>::at(const Key& key) {
+    iterator it = tree_.find(key);
+    if (it == tree_.end())
+        throw std::out_of_range("Key not found");
+    return it->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+const T& map<Key, T, Compare, Allocator>::at(const Key& key) const {
+    const_iterator it = tree_.find(key);
+    if (it == tree_.end())
+        throw std::out_of_range("Key not found");
+    return it->second;
+}
+
+// lower_bound заодно даёт подсказку для вставки: новый ключ встаёт прямо перед ним
+template <typename Key, typename T, typename Compare, typename Allocator>
+T& map<Key, T, Compare, Allocator>::operator[](const Key& key) {
+    iterator it = tree_.lower_bound(key);
+    if (it == tree_.end() || tree_.key_comp()(key, it->first))
+        it = tree_.emplaceHintUnique(it, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+    return it->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename map<Key, T, Compare, Allocator>::iterator, bool> map<Key, T, Compare, Allocator>::insert(const Key& key, const T& obj) {
+    iterator it = tree_.lower_bound(key);
+    if (it != tree_.end() && !tree_.key_comp()(key, it->first))
+        return {it, false};
+    return {tree_.emplaceHintUnique(it, key, obj), true};
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+std::pair<typename map<Key, T, Compare, Allocator>::iterator, bool> map<Key, T, Compare, Allocator>::insert_or_assign(const Key& key, const T& obj) {
+    iterator it = tree_.lower_bound(key);
+    if (it != tree_.end() && !tree_.key_comp()(key, it->first)) {
+        it->second = obj;
+        return {it, false};
+    }
+    return {tree_.emplaceHintUnique(it, key, obj), true};
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+template <typename... Args>
+vector<std::pair<typename map<Key, T, Compare, Allocator>::iterator, bool>> map<Key, T, Compare, Allocator>::insert_many(Args&&... args) {
+    vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    (result.push_back(tree_.emplaceUnique(std::forward<Args>(args))), ...);
+    return result;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_MAP_H
@@ -0,0 +1,236 @@
+#ifndef S21_CONTAINERS_MPMC_QUEUE_H
+#define S21_CONTAINERS_MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "cache_line.h"
+
+namespace s21 {
+
+// Ограниченная очередь для любого числа производителей и потребителей
+// (схема Вьюкова). У каждого слота есть номер-последовательность: слот
+// с номером pos свободен для записи pos-го элемента, с номером pos + 1 —
+// готов к чтению. Поток занимает позицию одним CAS по общему счётчику,
+// а потом работает со своим слотом, не мешая остальным.
+// Занятая позиция обязана быть заполнена (освобождена), иначе очередь
+// встанет на этом слоте, поэтому элементы переносятся и присваиваются
+// только операциями, которые не бросают исключений
+template <typename T, typename Allocator = std::allocator<T>>
+class mpmc_queue {
+    static_assert(std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value,
+                  "mpmc_queue requires nothrow move construction and assignment");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using allocator_type = Allocator;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    explicit mpmc_queue(size_type capacity, const allocator_type& alloc = allocator_type());
+    mpmc_queue(const mpmc_queue&) = delete;
+    mpmc_queue& operator=(const mpmc_queue&) = delete;
+    ~mpmc_queue();
+
+    // ------------------- ёмкость -------------------
+    size_type capacity() const noexcept { return mask_ + 1; }
+    // снимок: пока потоки работают, может уже не соответствовать очереди
+    size_type size_approx() const noexcept;
+
+    // ------------------- производители -------------------
+    bool try_push(const T& value) { return pushValue(T(value)); }
+    bool try_push(T&& value) { return pushValue(std::move(value)); }
+    // значение строится до занятия слота: бросить может только здесь
+    template <typename... Args>
+    bool try_emplace(Args&&... args) { return pushValue(T(std::forward<Args>(args)...)); }
+    // занимает подряд идущие свободные слоты одним CAS и переносит в них
+    // элементы [first, first + count); возвращает сколько положил.
+    // Построение T из *first не должно бросать — для копий дорогих типов
+    // передайте std::make_move_iterator
+    template <typename InputIt>
+    size_type push_bulk(InputIt first, size_type count);
+
+    // ------------------- потребители -------------------
+    bool try_pop(T& value);
+    // запись в out не должна бросать — например, заранее выделенный массив
+    template <typename OutputIt>
+    size_type pop_bulk(OutputIt out, size_type count);
+
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    struct Cell {
+        std::atomic<size_type> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+    using cell_allocator = typename alloc_traits::template rebind_alloc<Cell>;
+    using cell_traits = std::allocator_traits<cell_allocator>;
+
+    bool pushValue(T&& value) noexcept;
+    // сколько слотов подряд с позиции pos имеют номер pos + i + offset
+    size_type readyRun(size_type pos, size_type offset, size_type limit) const noexcept;
+
+    // только для чтения после конструктора
+    Cell* cells_ = nullptr;
+    size_type mask_ = 0;
+    cell_allocator alloc_;
+
+    alignas(kCacheLineSize) std::atomic<size_type> enqueuePos_{0};
+    // выравнивание класса по строке заодно отодвигает от dequeuePos_ соседние объекты
+    alignas(kCacheLineSize) std::atomic<size_type> dequeuePos_{0};
+};
+
+template <typename T, typename Allocator>
+mpmc_queue<T, Allocator>::mpmc_queue(size_type capacity, const allocator_type& alloc) : alloc_(alloc) {
+    if (capacity < 2 || capacity > cell_traits::max_size(alloc_) / 2)
+        throw std::length_error("Invalid mpmc_queue capacity");
+    size_type rounded = 2;
+    while (rounded < capacity)
+        rounded *= 2;
+    cells_ = cell_traits::allocate(alloc_, rounded);
+    mask_ = rounded - 1;
+    for (size_type index = 0; index < rounded; ++index)
+        new (&cells_[index].sequence) std::atomic<size_type>(index);
+}
+
+template <typename T, typename Allocator>
+mpmc_queue<T, Allocator>::~mpmc_queue() {
+    size_type tail = enqueuePos_.load(std::memory_order_relaxed);
+    for (size_type pos = dequeuePos_.load(std::memory_order_relaxed); pos != tail; ++pos)
+        cells_[pos & mask_].value()->~T();
+    cell_traits::deallocate(alloc_, cells_, mask_ + 1);
+}
+
+template <typename T, typename Allocator>
+typename mpmc_queue<T, Allocator>::size_type mpmc_queue<T, Allocator>::size_approx() const noexcept {
+    size_type head = dequeuePos_.load(std::memory_order_acquire);
+    size_type tail = enqueuePos_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+}
+
+template <typename T, typename Allocator>
+bool mpmc_queue<T, Allocator>::pushValue(T&& value) noexcept {
+    size_type pos = enqueuePos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_type sequence = cell->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+        if (diff == 0) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return false; // слот ещё не освобождён потребителем прошлого круга
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    new (cell->storage) T(std::move(value));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+bool mpmc_queue<T, Allocator>::try_pop(T& value) {
+    size_type pos = dequeuePos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_type sequence = cell->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+        if (diff == 0) {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return false; // пусто
+        } else {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    T* slot = cell->value();
+    value = std::move(*slot);
+    slot->~T();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+}
+
+// слоты, чьи номера совпали с ожидаемыми, никто не займёт, пока счётчик
+// позиции стоит на pos: любой другой поток сначала сдвинул бы его CAS-ом,
+// и наш CAS не прошёл бы
+template <typename T, typename Allocator>
+typename mpmc_queue<T, Allocator>::size_type
+mpmc_queue<T, Allocator>::readyRun(size_type pos, size_type offset, size_type limit) const noexcept {
+    size_type run = 0;
+    while (run < limit && cells_[(pos + run) & mask_].sequence.load(std::memory_order_acquire) == pos + run + offset)
+        ++run;
+    return run;
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt>
+typename mpmc_queue<T, Allocator>::size_type mpmc_queue<T, Allocator>::push_bulk(InputIt first, size_type count) {
+    static_assert(std::is_nothrow_constructible<T, decltype(*first)>::value,
+                  "push_bulk requires nothrow construction from *first");
+    if (count > capacity())
+        count = capacity();
+    size_type pos = enqueuePos_.load(std::memory_order_relaxed);
+    size_type run;
+    for (;;) {
+        run = readyRun(pos, 0, count);
+        if (run == 0) {
+            size_type current = enqueuePos_.load(std::memory_order_relaxed);
+            if (current == pos)
+                return 0; // первый же слот занят — очередь полна
+            pos = current;
+            continue;
+        }
+        if (enqueuePos_.compare_exchange_weak(pos, pos + run, std::memory_order_relaxed))
+            break;
+    }
+    for (size_type i = 0; i < run; ++i, ++first) {
+        Cell& cell = cells_[(pos + i) & mask_];
+        new (cell.storage) T(*first);
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    return run;
+}
+
+template <typename T, typename Allocator>
+template <typename OutputIt>
+typename mpmc_queue<T, Allocator>::size_type mpmc_queue<T, Allocator>::pop_bulk(OutputIt out, size_type count) {
+    if (count > capacity())
+        count = capacity();
+    size_type pos = dequeuePos_.load(std::memory_order_relaxed);
+    size_type run;
+    for (;;) {
+        run = readyRun(pos, 1, count);
+        if (run == 0) {
+            size_type current = dequeuePos_.load(std::memory_order_relaxed);
+            if (current == pos)
+                return 0;
+            pos = current;
+            continue;
+        }
+        if (dequeuePos_.compare_exchange_weak(pos, pos + run, std::memory_order_relaxed))
+            break;
+    }
+    for (size_type i = 0; i < run; ++i, ++out) {
+        Cell& cell = cells_[(pos + i) & mask_];
+        T* slot = cell.value();
+        *out = std::move(*slot);
+        slot->~T();
+        cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+    }
+    return run;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_MPMC_QUEUE_H
@@ -0,0 +1,106 @@
+#ifndef S21_CONTAINERS_MULTISET_H
+#define S21_CONTAINERS_MULTISET_H
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "pool_allocator.h"
+#include "tree.h"
+#include "vector.h"
+
+namespace s21 {
+
+// То же дерево, что у set, но равные ключи разрешены: новый встаёт после
+// уже имеющихся, поэтому порядок вставки равных сохраняется
+template <typename Key, typename Compare = std::less<Key>, typename Allocator = pool_allocator<Key>>
+class multiset {
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+
+private:
+    struct KeyOfValue {
+        const key_type& operator()(const value_type& value) const { return value; }
+    };
+    using tree_type = tree<key_type, value_type, KeyOfValue, Compare, Allocator>;
+
+public:
+    using iterator = typename tree_type::const_iterator;
+    using const_iterator = typename tree_type::const_iterator;
+    using size_type = size_t;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    multiset() = default;
+    explicit multiset(const Compare& comp, const allocator_type& alloc = allocator_type()) : tree_(comp, alloc) {}
+    multiset(std::initializer_list<value_type> const &items);
+    multiset(const multiset &ms) = default;
+    multiset(multiset &&ms) noexcept = default;
+    ~multiset() = default;
+
+    multiset& operator=(const multiset &ms) = default;
+    multiset& operator=(multiset &&ms) = default;
+
+    // ------------------- итераторы -------------------
+    iterator begin() const noexcept { return tree_.begin(); }
+    iterator end() const noexcept { return tree_.end(); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const noexcept { return tree_.empty(); }
+    size_type size() const noexcept { return tree_.size(); }
+    size_type max_size() const noexcept { return tree_.max_size(); }
+    allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept { tree_.clear(); }
+    iterator insert(const value_type& value) { return tree_.insertEqual(value); }
+    iterator insert(value_type&& value) { return tree_.insertEqual(std::move(value)); }
+    iterator insert(const_iterator hint, const value_type& value) { return tree_.emplaceHintEqual(hint, value); }
+    template <typename... Args>
+    iterator emplace(Args&&... args) { return tree_.emplaceEqual(std::forward<Args>(args)...); }
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args) { return tree_.emplaceHintEqual(hint, std::forward<Args>(args)...); }
+    iterator erase(const_iterator pos) { return tree_.erase(pos); }
+    iterator erase(const_iterator first, const_iterator last) { return tree_.erase(first, last); }
+    size_type erase(const Key& key) { return tree_.erase(key); }
+    void swap(multiset& other) noexcept { tree_.swap(other.tree_); }
+    void merge(multiset& other) { tree_.mergeEqual(other.tree_); } // splices nodes from another container
+    template <typename... Args>
+    vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+    // ------------------- поиск -------------------
+    size_type count(const Key& key) const { return tree_.count(key); }
+    iterator find(const Key& key) const { return tree_.find(key); }
+    bool contains(const Key& key) const { return tree_.contains(key); }
+    std::pair<iterator, iterator> equal_range(const Key& key) const { return tree_.equal_range(key); }
+    iterator lower_bound(const Key& key) const { return tree_.lower_bound(key); }
+    iterator upper_bound(const Key& key) const { return tree_.upper_bound(key); }
+    key_compare key_comp() const { return tree_.key_comp(); }
+
+private:
+    tree_type tree_;
+};
+
+template <typename Key, typename Compare, typename Allocator>
+multiset<Key, Compare, Allocator>::multiset(std::initializer_list<value_type> const &items) {
+    for (const value_type& item : items)
+        tree_.emplaceHintEqual(tree_.end(), item);
+}
+
+// в мультимножество вставка всегда удаётся, bool оставлен ради общего интерфейса
+template <typename Key, typename Compare, typename Allocator>
+template <typename... Args>
+vector<std::pair<typename multiset<Key, Compare, Allocator>::iterator, bool>> multiset<Key, Compare, Allocator>::insert_many(Args&&... args) {
+    vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    (result.push_back({tree_.emplaceEqual(std::forward<Args>(args)), true}), ...);
+    return result;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_MULTISET_H
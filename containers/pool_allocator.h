@@ -0,0 +1,201 @@
+#ifndef S21_CONTAINERS_POOL_ALLOCATOR_H
+#define S21_CONTAINERS_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <forward_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Ячейки одного размера: память берётся кусками (chunk), первый на
+// firstChunk ячеек, каждый следующий вдвое больше, но не больше maxChunk —
+// так маленький контейнер не держит сразу maxChunk узлов. Освобождённые
+// ячейки складываются в список свободных и выдаются повторно. Память
+// chunk'ов возвращается системе только в деструкторе
+class PoolSlots {
+public:
+    using size_type = std::size_t;
+
+    PoolSlots(size_type slotSize, size_type alignment, size_type firstChunk, size_type maxChunk) noexcept
+        : slotSize_(slotSize), alignment_(alignment), firstChunk_(firstChunk), maxChunk_(maxChunk) {}
+    PoolSlots(const PoolSlots&) = delete;
+    PoolSlots& operator=(const PoolSlots&) = delete;
+    ~PoolSlots();
+
+    bool fits(size_type slotSize, size_type alignment) const noexcept {
+        return slotSize_ == slotSize && alignment_ == alignment;
+    }
+    void* allocate();
+    void deallocate(void* p) noexcept;
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    struct Chunk {
+        Chunk* next;
+        unsigned char* slots;
+        size_type capacity;
+    };
+
+    size_type slotSize_;
+    size_type alignment_;
+    size_type firstChunk_;
+    size_type maxChunk_;
+    Chunk* chunks_ = nullptr;
+    size_type used_ = 0;
+    FreeSlot* free_ = nullptr;
+};
+
+// Общее состояние всех копий и перепривязок (rebind) одного pool_allocator:
+// по PoolSlots на каждый размер ячейки. Поэтому узел, выделенный через
+// pool_allocator<Node>, можно освободить через pool_allocator<T>, от
+// которого тот получен, и наоборот
+class PoolResource {
+public:
+    using size_type = std::size_t;
+
+    explicit PoolResource(size_type maxChunk) noexcept : maxChunk_(maxChunk) {}
+    PoolResource(const PoolResource&) = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+    // ячейка должна вмещать указатель списка свободных
+    template <typename T>
+    PoolSlots& slotsFor() {
+        constexpr size_type alignment = alignof(T) > alignof(void*) ? alignof(T) : alignof(void*);
+        constexpr size_type size = sizeof(T) > sizeof(void*) ? sizeof(T) : sizeof(void*);
+        constexpr size_type slotSize = (size + alignment - 1) / alignment * alignment;
+        for (PoolSlots& slots : pools_) {
+            if (slots.fits(slotSize, alignment))
+                return slots;
+        }
+        pools_.emplace_front(slotSize, alignment, maxChunk_ < 16 ? maxChunk_ : 16, maxChunk_);
+        return pools_.front();
+    }
+
+private:
+    size_type maxChunk_;
+    std::forward_list<PoolSlots> pools_;
+};
+
+// Аллокатор узлов поверх PoolResource. Копии и перепривязанные копии
+// разделяют один ресурс и равны между собой; новый pool_allocator()
+// заводит свой ресурс, который живёт, пока жива последняя копия.
+// Запросы на n != 1 объектов идут в std::allocator.
+// Ресурс не синхронизирован, поэтому копия контейнера получает свой пул
+// (select_on_container_copy_construction), а копирующее присваивание
+// оставляет контейнеру прежний: b = a и map b(a) не связывают a и b.
+// Перемещение и swap передают пул вместе с узлами — после них исходный
+// контейнер делит пул с новым, и менять их из разных потоков нельзя.
+// list::splice и list::merge между списком и его копией поэтому не
+// допускаются; map, set и multiset при слиянии копий переносят значения
+template <typename T, std::size_t ChunkSize = 1024>
+class pool_allocator {
+    static_assert(ChunkSize > 0, "ChunkSize must be positive");
+
+    template <typename U, std::size_t OtherChunkSize>
+    friend class pool_allocator;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template <typename U>
+    struct rebind {
+        using other = pool_allocator<U, ChunkSize>;
+    };
+
+    pool_allocator() : resource_(std::make_shared<PoolResource>(ChunkSize)) {}
+    pool_allocator(const pool_allocator& other) = default;
+    template <typename U>
+    pool_allocator(const pool_allocator<U, ChunkSize>& other) noexcept : resource_(other.resource_) {}
+    pool_allocator& operator=(const pool_allocator& other) = default;
+
+    pool_allocator select_on_container_copy_construction() const { return pool_allocator(); }
+
+    T* allocate(size_type n) {
+        if (n != 1)
+            return std::allocator<T>().allocate(n);
+        return static_cast<T*>(slots().allocate());
+    }
+
+    void deallocate(T* p, size_type n) noexcept {
+        if (n != 1)
+            std::allocator<T>().deallocate(p, n);
+        else
+            slots().deallocate(p);
+    }
+
+    template <typename U>
+    bool operator==(const pool_allocator<U, ChunkSize>& other) const noexcept {
+        return resource_ == other.resource_;
+    }
+    template <typename U>
+    bool operator!=(const pool_allocator<U, ChunkSize>& other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    // PoolSlots ищется при первом обращении, а не в конструкторе: в момент
+    // перепривязки тип узла может быть ещё неполным. Ячейки уже выделены
+    // через этот аллокатор, поэтому при освобождении поиск не бросает
+    PoolSlots& slots() {
+        if (slots_ == nullptr)
+            slots_ = &resource_->template slotsFor<T>();
+        return *slots_;
+    }
+
+    std::shared_ptr<PoolResource> resource_;
+    PoolSlots* slots_ = nullptr;
+};
+
+inline PoolSlots::~PoolSlots() {
+    while (chunks_ != nullptr) {
+        Chunk* next = chunks_->next;
+        ::operator delete(chunks_->slots, std::align_val_t(alignment_));
+        delete chunks_;
+        chunks_ = next;
+    }
+}
+
+// сначала переиспользуем освобождённые ячейки, затем берём следующую
+// нетронутую ячейку текущего chunk'а, и только потом заводим новый chunk
+inline void* PoolSlots::allocate() {
+    if (free_ != nullptr) {
+        FreeSlot* slot = free_;
+        free_ = slot->next;
+        return slot;
+    }
+    if (chunks_ == nullptr || used_ == chunks_->capacity) {
+        size_type capacity = chunks_ == nullptr ? firstChunk_ : chunks_->capacity * 2;
+        if (capacity > maxChunk_)
+            capacity = maxChunk_;
+        Chunk* chunk = new Chunk{chunks_, nullptr, capacity};
+        try {
+            chunk->slots = static_cast<unsigned char*>(
+                ::operator new(capacity * slotSize_, std::align_val_t(alignment_)));
+        } catch (...) {
+            delete chunk;
+            throw;
+        }
+        chunks_ = chunk;
+        used_ = 0;
+    }
+    return chunks_->slots + slotSize_ * used_++;
+}
+
+inline void PoolSlots::deallocate(void* p) noexcept {
+    FreeSlot* slot = ::new (p) FreeSlot{free_};
+    free_ = slot;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_POOL_ALLOCATOR_H
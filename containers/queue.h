@@ -0,0 +1,62 @@
+#ifndef S21_CONTAINERS_QUEUE_H
+#define S21_CONTAINERS_QUEUE_H
+
+#include <initializer_list>
+#include <utility>
+
+#include "ring_buffer.h"
+
+namespace s21 {
+
+// Очередь FIFO поверх любого контейнера с push_back/pop_front/front/back
+// (ring_buffer, list). По умолчанию — кольцевой буфер: push и pop не
+// выделяют память на элемент и не ходят по указателям
+template <typename T, typename Container = ring_buffer<T>>
+class queue {
+public:
+    using container_type = Container;
+    using value_type = typename Container::value_type;
+    using reference = typename Container::reference;
+    using const_reference = typename Container::const_reference;
+    using size_type = typename Container::size_type;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    queue() = default;
+    explicit queue(const Container& container) : c_(container) {}
+    explicit queue(Container&& container) : c_(std::move(container)) {}
+    queue(std::initializer_list<value_type> const &items) : c_(items) {}
+    queue(const queue &q) = default;
+    queue(queue &&q) = default;
+    ~queue() = default;
+
+    queue& operator=(const queue &q) = default;
+    queue& operator=(queue &&q) = default;
+
+    // -------------------  доступ к элементам -------------------
+    reference front() { return c_.front(); }
+    const_reference front() const { return c_.front(); }
+    reference back() { return c_.back(); }
+    const_reference back() const { return c_.back(); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const { return c_.empty(); }
+    size_type size() const { return c_.size(); }
+
+    // ------------------- модификаторы -------------------
+    void push(const_reference value) { c_.push_back(value); }
+    void push(value_type&& value) { c_.push_back(std::move(value)); }
+    template <typename... Args>
+    void emplace(Args&&... args) { c_.emplace_back(std::forward<Args>(args)...); }
+    void pop() { c_.pop_front(); }
+    void swap(queue& other) noexcept { c_.swap(other.c_); }
+    // appends new elements to the end of the queue
+    template <typename... Args>
+    void insert_many_back(Args&&... args) { (c_.emplace_back(std::forward<Args>(args)), ...); }
+
+private:
+    Container c_;
+};
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_QUEUE_H
@@ -0,0 +1,364 @@
+#ifndef S21_CONTAINERS_RING_BUFFER_H
+#define S21_CONTAINERS_RING_BUFFER_H
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Кольцевой буфер с ростом: элементы лежат в одном массиве ёмкостью 2^k,
+// логический индекс i живёт в слоте (head_ + i) & (capacity_ - 1).
+// Вставка и удаление с обоих концов — O(1) без выделения памяти на элемент;
+// при заполнении массив удваивается, и элементы переносятся в начало нового
+template <typename T, typename Allocator = std::allocator<T>>
+class ring_buffer {
+    template <bool Const>
+    class RingIterator;
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = RingIterator<false>;
+    using const_iterator = RingIterator<true>;
+    using size_type = size_t;
+    using allocator_type = Allocator;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    ring_buffer() noexcept(noexcept(Allocator())) {}
+    explicit ring_buffer(const allocator_type& alloc) noexcept : alloc_(alloc) {}
+    ring_buffer(std::initializer_list<value_type> const &items);
+    ring_buffer(const ring_buffer &r);
+    ring_buffer(ring_buffer &&r) noexcept;
+    ~ring_buffer();
+
+    ring_buffer& operator=(const ring_buffer &r);
+    ring_buffer& operator=(ring_buffer &&r) noexcept(std::allocator_traits<Allocator>::is_always_equal::value ||
+                                                     std::allocator_traits<Allocator>::
+                                                         propagate_on_container_move_assignment::value);
+
+    // -------------------  доступ к элементам -------------------
+    reference operator[](size_type pos) { return buffer_[slot(pos)]; }
+    const_reference operator[](size_type pos) const { return buffer_[slot(pos)]; }
+    reference front() { return buffer_[head_]; }
+    const_reference front() const { return buffer_[head_]; }
+    reference back() { return buffer_[slot(size_ - 1)]; }
+    const_reference back() const { return buffer_[slot(size_ - 1)]; }
+
+    // ------------------- итераторы -------------------
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type max_size() const noexcept { return alloc_traits::max_size(alloc_); }
+    size_type capacity() const noexcept { return capacity_; }
+    void reserve(size_type size); // ёмкость округляется вверх до степени двойки
+    allocator_type get_allocator() const { return alloc_; }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept;
+    void push_back(const_reference value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+    void push_front(const_reference value) { emplace_front(value); }
+    void push_front(value_type&& value) { emplace_front(std::move(value)); }
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    template <typename... Args>
+    reference emplace_front(Args&&... args);
+    void pop_back();
+    void pop_front();
+    void swap(ring_buffer& other) noexcept;
+
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    // как в s21::vector: memcpy допустим, только если тип тривиально
+    // копируемый и аллокатор не подменяет construct/destroy
+    static constexpr bool kTriviallyRelocatable =
+        std::is_trivially_copyable<T>::value && std::is_same<Allocator, std::allocator<T>>::value;
+
+    size_type slot(size_type pos) const noexcept { return (head_ + pos) & (capacity_ - 1); }
+    void reallocate(size_type newCapacity);
+    void destroyAll() noexcept;
+    void deallocate() noexcept;
+
+    T* buffer_ = nullptr;
+    size_type capacity_ = 0;
+    size_type head_ = 0;
+    size_type size_ = 0;
+    Allocator alloc_;
+};
+
+// итератор хранит логический индекс, поэтому переход через конец массива
+// не требует ветвления: слот пересчитывается маской при разыменовании
+template <typename T, typename Allocator>
+template <bool Const>
+class ring_buffer<T, Allocator>::RingIterator {
+    using owner_type = typename std::conditional<Const, const ring_buffer, ring_buffer>::type;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<Const, const T*, T*>::type;
+    using reference = typename std::conditional<Const, const T&, T&>::type;
+
+    RingIterator() = default;
+    RingIterator(owner_type* owner, size_type index) : owner_(owner), index_(index) {}
+    // iterator -> const_iterator
+    template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+    RingIterator(const RingIterator<OtherConst>& other) : owner_(other.owner_), index_(other.index_) {}
+
+    reference operator*() const { return (*owner_)[index_]; }
+    pointer operator->() const { return &(*owner_)[index_]; }
+
+    RingIterator& operator++() {
+        ++index_;
+        return *this;
+    }
+    RingIterator operator++(int) {
+        RingIterator temp = *this;
+        ++index_;
+        return temp;
+    }
+    RingIterator& operator--() {
+        --index_;
+        return *this;
+    }
+    RingIterator operator--(int) {
+        RingIterator temp = *this;
+        --index_;
+        return temp;
+    }
+
+    bool operator==(const RingIterator& other) const { return index_ == other.index_; }
+    bool operator!=(const RingIterator& other) const { return index_ != other.index_; }
+
+private:
+    template <bool>
+    friend class RingIterator;
+
+    owner_type* owner_ = nullptr;
+    size_type index_ = 0;
+};
+
+// ------------------------------------- конструкторы и деструкторы -------------------------------------
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    try {
+        for (const value_type& item : items)
+            emplace_back(item);
+    } catch (...) {
+        clear();
+        deallocate();
+        throw;
+    }
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(const ring_buffer &r)
+    : alloc_(alloc_traits::select_on_container_copy_construction(r.alloc_)) {
+    reserve(r.size_);
+    try {
+        for (size_type i = 0; i < r.size_; ++i)
+            emplace_back(r[i]);
+    } catch (...) {
+        clear();
+        deallocate();
+        throw;
+    }
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(ring_buffer &&r) noexcept
+    : buffer_(r.buffer_), capacity_(r.capacity_), head_(r.head_), size_(r.size_), alloc_(std::move(r.alloc_)) {
+    r.buffer_ = nullptr;
+    r.capacity_ = r.head_ = r.size_ = 0;
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::~ring_buffer() {
+    destroyAll();
+    deallocate();
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>& ring_buffer<T, Allocator>::operator=(const ring_buffer &r) {
+    if (this != &r) {
+        ring_buffer copy(r);
+        swap(copy);
+    }
+    return *this;
+}
+
+// буфер r забирается, только если его сможет освободить наш аллокатор,
+// иначе элементы переносятся по одному в свой буфер
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>& ring_buffer<T, Allocator>::operator=(ring_buffer &&r) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+    if (this == &r)
+        return *this;
+    clear();
+    if (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value &&
+        !(alloc_ == r.alloc_)) {
+        reserve(r.size_);
+        for (size_type pos = 0; pos < r.size_; ++pos)
+            emplace_back(std::move(r[pos]));
+        r.clear();
+        return *this;
+    }
+    deallocate();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+        alloc_ = std::move(r.alloc_);
+    buffer_ = r.buffer_;
+    capacity_ = r.capacity_;
+    head_ = r.head_;
+    size_ = r.size_;
+    r.buffer_ = nullptr;
+    r.capacity_ = r.head_ = r.size_ = 0;
+    return *this;
+}
+
+// --------------------------------------- память -------------------------------------
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::reserve(size_type size) {
+    if (size <= capacity_)
+        return;
+    if (size > max_size())
+        throw std::length_error("Ring buffer is too large");
+    size_type newCapacity = capacity_ == 0 ? 8 : capacity_;
+    while (newCapacity < size)
+        newCapacity *= 2;
+    reallocate(newCapacity);
+}
+
+// элементы переезжают в начало нового массива, head_ становится нулём.
+// move_if_noexcept: если копирование бросит, старый буфер остаётся целым
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::reallocate(size_type newCapacity) {
+    T* newBuffer = alloc_traits::allocate(alloc_, newCapacity);
+    // тривиальные элементы — два memcpy: от head_ до конца массива и с начала
+    if constexpr (kTriviallyRelocatable) {
+        size_type tail = capacity_ - head_ < size_ ? capacity_ - head_ : size_;
+        if (size_ != 0) {
+            std::memcpy(static_cast<void*>(newBuffer), buffer_ + head_, tail * sizeof(T));
+            std::memcpy(static_cast<void*>(newBuffer + tail), buffer_, (size_ - tail) * sizeof(T));
+        }
+    } else {
+        size_type moved = 0;
+        try {
+            for (; moved < size_; ++moved)
+                alloc_traits::construct(alloc_, newBuffer + moved, std::move_if_noexcept(buffer_[slot(moved)]));
+        } catch (...) {
+            for (size_type i = 0; i < moved; ++i)
+                alloc_traits::destroy(alloc_, newBuffer + i);
+            alloc_traits::deallocate(alloc_, newBuffer, newCapacity);
+            throw;
+        }
+        destroyAll();
+    }
+    deallocate();
+    buffer_ = newBuffer;
+    capacity_ = newCapacity;
+    head_ = 0;
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::destroyAll() noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (size_type i = 0; i < size_; ++i)
+            alloc_traits::destroy(alloc_, buffer_ + slot(i));
+    }
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::deallocate() noexcept {
+    if (buffer_ != nullptr)
+        alloc_traits::deallocate(alloc_, buffer_, capacity_);
+    buffer_ = nullptr;
+    capacity_ = 0;
+}
+
+// --------------------------------------- модификаторы -------------------------------------
+
+// новый элемент строится до переноса: args может ссылаться на элемент буфера
+template <typename T, typename Allocator>
+template <typename... Args>
+typename ring_buffer<T, Allocator>::reference ring_buffer<T, Allocator>::emplace_back(Args&&... args) {
+    if (size_ == capacity_) {
+        value_type value(std::forward<Args>(args)...);
+        reserve(size_ + 1);
+        alloc_traits::construct(alloc_, buffer_ + slot(size_), std::move(value));
+    } else {
+        alloc_traits::construct(alloc_, buffer_ + slot(size_), std::forward<Args>(args)...);
+    }
+    ++size_;
+    return back();
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename ring_buffer<T, Allocator>::reference ring_buffer<T, Allocator>::emplace_front(Args&&... args) {
+    if (size_ == capacity_) {
+        value_type value(std::forward<Args>(args)...);
+        reserve(size_ + 1);
+        head_ = (head_ - 1) & (capacity_ - 1);
+        alloc_traits::construct(alloc_, buffer_ + head_, std::move(value));
+    } else {
+        size_type newHead = (head_ - 1) & (capacity_ - 1);
+        alloc_traits::construct(alloc_, buffer_ + newHead, std::forward<Args>(args)...);
+        head_ = newHead;
+    }
+    ++size_;
+    return front();
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::pop_back() {
+    if (size_ == 0)
+        throw std::out_of_range("Ring buffer is empty");
+    --size_;
+    alloc_traits::destroy(alloc_, buffer_ + slot(size_));
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::pop_front() {
+    if (size_ == 0)
+        throw std::out_of_range("Ring buffer is empty");
+    alloc_traits::destroy(alloc_, buffer_ + head_);
+    head_ = (head_ + 1) & (capacity_ - 1);
+    --size_;
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::clear() noexcept {
+    destroyAll();
+    head_ = size_ = 0;
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::swap(ring_buffer& other) noexcept {
+    std::swap(buffer_, other.buffer_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(alloc_, other.alloc_);
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_RING_BUFFER_H
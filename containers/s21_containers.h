@@ -0,0 +1,11 @@
+#ifndef S21_CONTAINERS_H
+#define S21_CONTAINERS_H
+
+#include "list.h"
+#include "map.h"
+#include "queue.h"
+#include "set.h"
+#include "stack.h"
+#include "vector.h"
+
+#endif // S21_CONTAINERS_H
@@ -0,0 +1,14 @@
+#ifndef S21_CONTAINERSPLUS_H
+#define S21_CONTAINERSPLUS_H
+
+#include "array.h"
+#include "flat_map.h"
+#include "flat_set.h"
+#include "intrusive_list.h"
+#include "multiset.h"
+#include "small_vector.h"
+#include "unordered_map.h"
+#include "unordered_set.h"
+#include "unrolled_list.h"
+
+#endif // S21_CONTAINERSPLUS_H
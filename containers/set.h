@@ -0,0 +1,106 @@
+#ifndef S21_CONTAINERS_SET_H
+#define S21_CONTAINERS_SET_H
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "pool_allocator.h"
+#include "tree.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Множество уникальных ключей поверх красно-чёрного дерева. Ключи менять
+// нельзя, поэтому iterator здесь — константный итератор дерева.
+// Узлы по умолчанию берутся из pool_allocator, как в map
+template <typename Key, typename Compare = std::less<Key>, typename Allocator = pool_allocator<Key>>
+class set {
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+
+private:
+    struct KeyOfValue {
+        const key_type& operator()(const value_type& value) const { return value; }
+    };
+    using tree_type = tree<key_type, value_type, KeyOfValue, Compare, Allocator>;
+
+public:
+    using iterator = typename tree_type::const_iterator;
+    using const_iterator = typename tree_type::const_iterator;
+    using size_type = size_t;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    set() = default;
+    explicit set(const Compare& comp, const allocator_type& alloc = allocator_type()) : tree_(comp, alloc) {}
+    set(std::initializer_list<value_type> const &items);
+    set(const set &s) = default;
+    set(set &&s) noexcept = default;
+    ~set() = default;
+
+    set& operator=(const set &s) = default;
+    set& operator=(set &&s) = default;
+
+    // ------------------- итераторы -------------------
+    iterator begin() const noexcept { return tree_.begin(); }
+    iterator end() const noexcept { return tree_.end(); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const noexcept { return tree_.empty(); }
+    size_type size() const noexcept { return tree_.size(); }
+    size_type max_size() const noexcept { return tree_.max_size(); }
+    allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept { tree_.clear(); }
+    std::pair<iterator, bool> insert(const value_type& value) { return tree_.insertUnique(value); }
+    std::pair<iterator, bool> insert(value_type&& value) { return tree_.insertUnique(std::move(value)); }
+    iterator insert(const_iterator hint, const value_type& value) { return tree_.emplaceHintUnique(hint, value); }
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) { return tree_.emplaceUnique(std::forward<Args>(args)...); }
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args) { return tree_.emplaceHintUnique(hint, std::forward<Args>(args)...); }
+    iterator erase(const_iterator pos) { return tree_.erase(pos); }
+    iterator erase(const_iterator first, const_iterator last) { return tree_.erase(first, last); }
+    size_type erase(const Key& key) { return tree_.eraseUnique(key); }
+    void swap(set& other) noexcept { tree_.swap(other.tree_); }
+    void merge(set& other) { tree_.mergeUnique(other.tree_); } // splices nodes from another container
+    template <typename... Args>
+    vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+    // ------------------- поиск -------------------
+    iterator find(const Key& key) const { return tree_.find(key); }
+    bool contains(const Key& key) const { return tree_.contains(key); }
+    size_type count(const Key& key) const { return tree_.contains(key) ? 1 : 0; }
+    iterator lower_bound(const Key& key) const { return tree_.lower_bound(key); }
+    iterator upper_bound(const Key& key) const { return tree_.upper_bound(key); }
+    std::pair<iterator, iterator> equal_range(const Key& key) const { return tree_.equal_range(key); }
+    key_compare key_comp() const { return tree_.key_comp(); }
+
+private:
+    tree_type tree_;
+};
+
+template <typename Key, typename Compare, typename Allocator>
+set<Key, Compare, Allocator>::set(std::initializer_list<value_type> const &items) {
+    for (const value_type& item : items)
+        tree_.emplaceHintUnique(tree_.end(), item);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename... Args>
+vector<std::pair<typename set<Key, Compare, Allocator>::iterator, bool>> set<Key, Compare, Allocator>::insert_many(Args&&... args) {
+    vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    (result.push_back(tree_.emplaceUnique(std::forward<Args>(args))), ...);
+    return result;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_SET_H
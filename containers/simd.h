@@ -0,0 +1,368 @@
+#ifndef S21_CONTAINERS_SIMD_H
+#define S21_CONTAINERS_SIMD_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// Векторные ядра для contiguous-диапазонов арифметических типов: find,
+// count, min/max, сумма, сравнение на равенство и fill.
+// Ядра написаны один раз на векторных расширениях GCC (vector_size) и
+// встраиваются в точки входа с target("avx2") и target("sse4.2"): один и
+// тот же код превращается в 256- и 128-битные инструкции. Уровень
+// выбирается один раз при первом вызове по __builtin_cpu_supports, без
+// поддержки (другой компилятор или архитектура) работает обычный цикл.
+// Сумма целых считается по модулю 2^N, как в беззнаковой арифметике;
+// сумма float/double складывает дорожки в другом порядке, чем цикл, и
+// может отличаться от него на ошибку округления. min/max при NaN в
+// диапазоне не определены
+
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#define S21_SIMD_INLINE inline __attribute__((always_inline))
+#define S21_SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+
+enum class simd_level { scalar, sse42, avx2 };
+
+// для каких T есть векторные ядра: арифметические типы, кроме bool и long double
+template <typename T>
+constexpr bool kSimdKernelType = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8;
+
+inline simd_level current_simd_level() noexcept {
+#if S21_SIMD_X86
+    static const simd_level level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return simd_level::avx2;
+        if (__builtin_cpu_supports("sse4.2"))
+            return simd_level::sse42;
+        return simd_level::scalar;
+    }();
+    return level;
+#else
+    return simd_level::scalar;
+#endif
+}
+
+// целые складываются беззнаково: переполнение не UB, а перенос по модулю
+template <typename T>
+using SimdSumType = typename std::conditional_t<std::is_integral_v<T>, std::make_unsigned<T>, std::common_type<T>>::type;
+
+template <typename T>
+T scalarSum(const T* first, const T* last) noexcept {
+    SimdSumType<T> sum = 0;
+    for (; first != last; ++first)
+        sum += static_cast<SimdSumType<T>>(*first);
+    return static_cast<T>(sum);
+}
+
+// первый min и первый max в непустом диапазоне
+template <typename T>
+std::pair<T, T> scalarMinMax(const T* first, const T* last) noexcept {
+    T low = *first;
+    T high = *first;
+    for (++first; first != last; ++first) {
+        low = *first < low ? *first : low;
+        high = high < *first ? *first : high;
+    }
+    return {low, high};
+}
+
+#if S21_SIMD_X86
+
+// ------------------------------------- ядра на Bytes-байтовых векторах -------------------------------------
+// векторы не передаются между функциями по значению: у 256-битных без
+// AVX другое ABI, поэтому всё нужное встраивается в точку входа
+
+template <typename T, std::size_t Bytes>
+struct SimdLanes {
+    typedef T vector __attribute__((vector_size(Bytes)));
+    typedef SimdSumType<T> sum_vector __attribute__((vector_size(Bytes)));
+    // результат сравнения: целые той же ширины, -1 или 0 в каждой дорожке
+    using mask = decltype(vector{} == vector{});
+    typedef long long words __attribute__((vector_size(Bytes)));
+    static constexpr std::size_t kCount = Bytes / sizeof(T);
+};
+
+// есть ли ненулевая дорожка: маска проверяется 64-битными словами
+template <typename Lanes>
+S21_SIMD_INLINE bool anyLane(const typename Lanes::mask& mask) noexcept {
+    typename Lanes::words parts;
+    std::memcpy(&parts, &mask, sizeof(parts));
+    long long any = 0;
+    for (std::size_t i = 0; i < sizeof(parts) / sizeof(long long); ++i)
+        any |= parts[i];
+    return any != 0;
+}
+
+// проверка совпадения дорожек дорогая, поэтому делается раз на четыре блока
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE const T* findLanes(const T* first, const T* last, T value) noexcept {
+    using Lanes = SimdLanes<T, Bytes>;
+    using vector = typename Lanes::vector;
+    const vector needle = vector{} + value;
+    for (; static_cast<std::size_t>(last - first) >= 4 * Lanes::kCount; first += 4 * Lanes::kCount) {
+        vector a, b, c, d;
+        std::memcpy(&a, first, Bytes);
+        std::memcpy(&b, first + Lanes::kCount, Bytes);
+        std::memcpy(&c, first + 2 * Lanes::kCount, Bytes);
+        std::memcpy(&d, first + 3 * Lanes::kCount, Bytes);
+        const typename Lanes::mask hit = (a == needle) | (b == needle) | (c == needle) | (d == needle);
+        if (anyLane<Lanes>(hit))
+            break;
+    }
+    // совпадение внутри найденных блоков или в хвосте
+    return std::find(first, last, value);
+}
+
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE std::size_t countLanes(const T* first, const T* last, T value) noexcept {
+    using Lanes = SimdLanes<T, Bytes>;
+    using mask = typename Lanes::mask;
+    // узкие счётчики дорожек сбрасываются в общий раньше, чем переполнятся
+    constexpr std::size_t kFlush = sizeof(T) >= 4 ? std::size_t(1) << 16 : (std::size_t(1) << (8 * sizeof(T) - 1)) - 1;
+    const typename Lanes::vector needle = typename Lanes::vector{} + value;
+    std::size_t total = 0;
+    while (static_cast<std::size_t>(last - first) >= Lanes::kCount) {
+        const std::size_t blocks = std::min(static_cast<std::size_t>(last - first) / Lanes::kCount, kFlush);
+        mask counts = mask{};
+        for (std::size_t b = 0; b < blocks; ++b, first += Lanes::kCount) {
+            typename Lanes::vector block;
+            std::memcpy(&block, first, Bytes);
+            counts -= block == needle;
+        }
+        for (std::size_t i = 0; i < Lanes::kCount; ++i)
+            total += static_cast<std::size_t>(counts[i]);
+    }
+    return total + static_cast<std::size_t>(std::count(first, last, value));
+}
+
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE T sumLanes(const T* first, const T* last) noexcept {
+    using Lanes = SimdLanes<T, Bytes>;
+    typename Lanes::sum_vector sums = typename Lanes::sum_vector{};
+    for (; static_cast<std::size_t>(last - first) >= Lanes::kCount; first += Lanes::kCount) {
+        typename Lanes::sum_vector block;
+        std::memcpy(&block, first, Bytes);
+        sums += block;
+    }
+    SimdSumType<T> sum = static_cast<SimdSumType<T>>(scalarSum(first, last));
+    for (std::size_t i = 0; i < Lanes::kCount; ++i)
+        sum += sums[i];
+    return static_cast<T>(sum);
+}
+
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE std::pair<T, T> minMaxLanes(const T* first, const T* last) noexcept {
+    using Lanes = SimdLanes<T, Bytes>;
+    if (static_cast<std::size_t>(last - first) < Lanes::kCount)
+        return scalarMinMax(first, last);
+    typename Lanes::vector low;
+    std::memcpy(&low, first, Bytes);
+    typename Lanes::vector high = low;
+    for (first += Lanes::kCount; static_cast<std::size_t>(last - first) >= Lanes::kCount; first += Lanes::kCount) {
+        typename Lanes::vector block;
+        std::memcpy(&block, first, Bytes);
+        low = block < low ? block : low;
+        high = high < block ? block : high;
+    }
+    std::pair<T, T> result(low[0], high[0]);
+    for (std::size_t i = 1; i < Lanes::kCount; ++i) {
+        result.first = low[i] < result.first ? low[i] : result.first;
+        result.second = result.second < high[i] ? high[i] : result.second;
+    }
+    if (first != last) {
+        const std::pair<T, T> tail = scalarMinMax(first, last);
+        result.first = tail.first < result.first ? tail.first : result.first;
+        result.second = result.second < tail.second ? tail.second : result.second;
+    }
+    return result;
+}
+
+// плавающие сравниваются через ==, а не memcmp: NaN не равен себе, а +0
+// равен -0. Для целых равенство побитовое, и memcmp из libc уже векторный
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE bool equalLanes(const T* first, const T* last, const T* other) noexcept {
+    using Lanes = SimdLanes<T, Bytes>;
+    using vector = typename Lanes::vector;
+    if constexpr (std::is_integral_v<T>) {
+        return first == last || std::memcmp(first, other, static_cast<std::size_t>(last - first) * sizeof(T)) == 0;
+    } else {
+        for (; static_cast<std::size_t>(last - first) >= 4 * Lanes::kCount;
+             first += 4 * Lanes::kCount, other += 4 * Lanes::kCount) {
+            typename Lanes::mask differ = typename Lanes::mask{};
+            for (std::size_t block = 0; block < 4; ++block) {
+                vector left, right;
+                std::memcpy(&left, first + block * Lanes::kCount, Bytes);
+                std::memcpy(&right, other + block * Lanes::kCount, Bytes);
+                differ |= left != right;
+            }
+            if (anyLane<Lanes>(differ))
+                return false;
+        }
+        return std::equal(first, last, other);
+    }
+}
+
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE void fillLanes(T* first, T* last, T value) noexcept {
+    using Lanes = SimdLanes<T, Bytes>;
+    const typename Lanes::vector block = typename Lanes::vector{} + value;
+    for (; static_cast<std::size_t>(last - first) >= Lanes::kCount; first += Lanes::kCount)
+        std::memcpy(first, &block, Bytes);
+    std::fill(first, last, value);
+}
+
+// ------------------------------------- точки входа по уровням -------------------------------------
+
+template <typename T>
+S21_SIMD_TARGET("avx2") const T* findAvx2(const T* first, const T* last, T value) noexcept {
+    return findLanes<T, 32>(first, last, value);
+}
+template <typename T>
+S21_SIMD_TARGET("sse4.2") const T* findSse42(const T* first, const T* last, T value) noexcept {
+    return findLanes<T, 16>(first, last, value);
+}
+template <typename T>
+S21_SIMD_TARGET("avx2") std::size_t countAvx2(const T* first, const T* last, T value) noexcept {
+    return countLanes<T, 32>(first, last, value);
+}
+template <typename T>
+S21_SIMD_TARGET("sse4.2") std::size_t countSse42(const T* first, const T* last, T value) noexcept {
+    return countLanes<T, 16>(first, last, value);
+}
+template <typename T>
+S21_SIMD_TARGET("avx2") T sumAvx2(const T* first, const T* last) noexcept {
+    return sumLanes<T, 32>(first, last);
+}
+template <typename T>
+S21_SIMD_TARGET("sse4.2") T sumSse42(const T* first, const T* last) noexcept {
+    return sumLanes<T, 16>(first, last);
+}
+template <typename T>
+S21_SIMD_TARGET("avx2") std::pair<T, T> minMaxAvx2(const T* first, const T* last) noexcept {
+    return minMaxLanes<T, 32>(first, last);
+}
+template <typename T>
+S21_SIMD_TARGET("sse4.2") std::pair<T, T> minMaxSse42(const T* first, const T* last) noexcept {
+    return minMaxLanes<T, 16>(first, last);
+}
+template <typename T>
+S21_SIMD_TARGET("avx2") bool equalAvx2(const T* first, const T* last, const T* other) noexcept {
+    return equalLanes<T, 32>(first, last, other);
+}
+template <typename T>
+S21_SIMD_TARGET("sse4.2") bool equalSse42(const T* first, const T* last, const T* other) noexcept {
+    return equalLanes<T, 16>(first, last, other);
+}
+template <typename T>
+S21_SIMD_TARGET("avx2") void fillAvx2(T* first, T* last, T value) noexcept {
+    fillLanes<T, 32>(first, last, value);
+}
+template <typename T>
+S21_SIMD_TARGET("sse4.2") void fillSse42(T* first, T* last, T value) noexcept {
+    fillLanes<T, 16>(first, last, value);
+}
+
+#endif // S21_SIMD_X86
+
+// ------------------------------------- диспетчеризация -------------------------------------
+// для остальных T — те же операции обычным циклом
+
+template <typename T>
+const T* simd_find(const T* first, const T* last, const T& value) {
+#if S21_SIMD_X86
+    if constexpr (kSimdKernelType<T>) {
+        switch (current_simd_level()) {
+            case simd_level::avx2: return findAvx2(first, last, value);
+            case simd_level::sse42: return findSse42(first, last, value);
+            case simd_level::scalar: break;
+        }
+    }
+#endif
+    return std::find(first, last, value);
+}
+
+template <typename T>
+std::size_t simd_count(const T* first, const T* last, const T& value) {
+#if S21_SIMD_X86
+    if constexpr (kSimdKernelType<T>) {
+        switch (current_simd_level()) {
+            case simd_level::avx2: return countAvx2(first, last, value);
+            case simd_level::sse42: return countSse42(first, last, value);
+            case simd_level::scalar: break;
+        }
+    }
+#endif
+    return static_cast<std::size_t>(std::count(first, last, value));
+}
+
+template <typename T>
+T simd_sum(const T* first, const T* last) {
+    static_assert(std::is_arithmetic_v<T>, "simd_sum requires an arithmetic type");
+#if S21_SIMD_X86
+    if constexpr (kSimdKernelType<T>) {
+        switch (current_simd_level()) {
+            case simd_level::avx2: return sumAvx2(first, last);
+            case simd_level::sse42: return sumSse42(first, last);
+            case simd_level::scalar: break;
+        }
+    }
+#endif
+    return scalarSum(first, last);
+}
+
+// значения min и max непустого диапазона
+template <typename T>
+std::pair<T, T> simd_minmax(const T* first, const T* last) {
+    static_assert(std::is_arithmetic_v<T>, "simd_minmax requires an arithmetic type");
+#if S21_SIMD_X86
+    if constexpr (kSimdKernelType<T>) {
+        switch (current_simd_level()) {
+            case simd_level::avx2: return minMaxAvx2(first, last);
+            case simd_level::sse42: return minMaxSse42(first, last);
+            case simd_level::scalar: break;
+        }
+    }
+#endif
+    return scalarMinMax(first, last);
+}
+
+template <typename T>
+bool simd_equal(const T* first, const T* last, const T* other) {
+#if S21_SIMD_X86
+    if constexpr (kSimdKernelType<T>) {
+        switch (current_simd_level()) {
+            case simd_level::avx2: return equalAvx2(first, last, other);
+            case simd_level::sse42: return equalSse42(first, last, other);
+            case simd_level::scalar: break;
+        }
+    }
+#endif
+    return std::equal(first, last, other);
+}
+
+template <typename T>
+void simd_fill(T* first, T* last, const T& value) {
+#if S21_SIMD_X86
+    if constexpr (kSimdKernelType<T>) {
+        switch (current_simd_level()) {
+            case simd_level::avx2: fillAvx2(first, last, value); return;
+            case simd_level::sse42: fillSse42(first, last, value); return;
+            case simd_level::scalar: break;
+        }
+    }
+#endif
+    std::fill(first, last, value);
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_SIMD_H
@@ -0,0 +1,267 @@
+#ifndef S21_CONTAINERS_SMALL_VECTOR_H
+#define S21_CONTAINERS_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "simd.h"
+#include "vector_base.h"
+
+namespace s21 {
+
+// Встроенный буфер small_vector. Это отдельная база, стоящая перед
+// VectorBase: к моменту, когда VectorBase запоминает data_, буфер уже есть
+template <typename T, std::size_t N>
+class SmallVectorBuffer {
+protected:
+    T* inlineData() noexcept { return std::launder(reinterpret_cast<T*>(inline_)); }
+
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+};
+
+// Вектор с буфером на N элементов внутри самого объекта: пока элементов не
+// больше N, куча не трогается. При переполнении элементы переносятся в
+// буфер из аллокатора и дальше растут как у s21::vector (в 2 раза);
+// shrink_to_fit возвращает их во встроенный буфер, если они туда помещаются.
+// capacity() == N ровно тогда, когда элементы лежат во встроенном буфере.
+//
+// В отличие от s21::vector, перемещение и swap встроенного буфера
+// переносят сами элементы, поэтому они портят итераторы и бросают, если
+// бросает перемещение T; у буфера в куче передаётся только указатель
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class small_vector : private SmallVectorBuffer<T, N>,
+                     public VectorBase<small_vector<T, N, Allocator>, T, Allocator> {
+    static_assert(N > 0, "small_vector without inline storage is s21::vector");
+    using Buffer = SmallVectorBuffer<T, N>;
+    using Base = VectorBase<small_vector<T, N, Allocator>, T, Allocator>;
+    friend Base;
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = size_t;
+    using allocator_type = Allocator;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    small_vector() noexcept(noexcept(Allocator())) : Base(Buffer::inlineData(), N) {}
+    explicit small_vector(const allocator_type& alloc) noexcept : Base(Buffer::inlineData(), N, alloc) {}
+    explicit small_vector(size_type n);
+    small_vector(std::initializer_list<value_type> const &items);
+    small_vector(const small_vector &v);
+    small_vector(small_vector &&v) noexcept(std::is_nothrow_move_constructible<T>::value);
+    ~small_vector();
+
+    small_vector& operator=(const small_vector &v);
+    small_vector& operator=(small_vector &&v) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                                       (std::allocator_traits<Allocator>::is_always_equal::value ||
+                                                        std::allocator_traits<Allocator>::
+                                                            propagate_on_container_move_assignment::value));
+
+    // ------------------- ёмкость и модификаторы -------------------
+    // доступ, вставка и удаление — в VectorBase
+    void shrink_to_fit();
+    void swap(small_vector& other) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                            std::is_nothrow_move_assignable<T>::value);
+
+private:
+    using typename Base::alloc_traits;
+    using Base::data_;
+    using Base::size_;
+    using Base::capacity_;
+    using Base::alloc_;
+    using Base::relocate;
+    using Base::destroyRange;
+    using Buffer::inline_;
+    using Buffer::inlineData;
+
+    // небольшой встроенный буфер тривиальных типов дешевле скопировать
+    // целиком, чем вызывать memcpy на size_ элементов
+    static constexpr bool kCopyWholeInline = Base::kTriviallyRelocatable && N * sizeof(T) <= 64;
+
+    bool isInline() const noexcept { return data_ == reinterpret_cast<const T*>(inline_); }
+
+    void stealFrom(small_vector& v);
+    void reallocate(size_type newCapacity);
+    void deallocate() noexcept;
+};
+
+template <typename T, std::size_t N, typename Allocator>
+bool operator==(const small_vector<T, N, Allocator>& left, const small_vector<T, N, Allocator>& right) {
+    return left.size() == right.size() && simd_equal(left.begin(), left.end(), right.begin());
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool operator!=(const small_vector<T, N, Allocator>& left, const small_vector<T, N, Allocator>& right) {
+    return !(left == right);
+}
+
+// ------------------------------------- конструкторы и деструкторы -------------------------------------
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(size_type n) : Base(Buffer::inlineData(), N) {
+    this->constructDefault(n);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(std::initializer_list<value_type> const &items)
+    : Base(Buffer::inlineData(), N) {
+    this->constructCopies(items.begin(), items.size());
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(const small_vector &v)
+    : Base(Buffer::inlineData(), N, alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+    this->constructCopies(v.data_, v.size_);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(small_vector &&v) noexcept(std::is_nothrow_move_constructible<T>::value)
+    : Base(Buffer::inlineData(), N, v.alloc_) {
+    stealFrom(v);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::~small_vector() {
+    this->clear();
+    deallocate();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>& small_vector<T, N, Allocator>::operator=(const small_vector &v) {
+    if (this != &v) {
+        small_vector copy(v);
+        swap(copy);
+    }
+    return *this;
+}
+
+// буфер v забирается целиком, только если его сможет освободить наш аллокатор
+template <typename T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>& small_vector<T, N, Allocator>::operator=(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible<T>::value &&
+    (std::allocator_traits<Allocator>::is_always_equal::value ||
+     std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value)) {
+    if (this != &v) {
+        this->clear();
+        deallocate();
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+            alloc_ = v.alloc_;
+        if (alloc_traits::is_always_equal::value || alloc_ == v.alloc_) {
+            stealFrom(v);
+        } else {
+            this->reserve(v.size_);
+            relocate(v.data_, v.data_ + v.size_, data_);
+            size_ = v.size_;
+            v.clear();
+        }
+    }
+    return *this;
+}
+
+// --------------------------------------- ёмкость -------------------------------------
+
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::shrink_to_fit() {
+    if (capacity_ > size_ && !isInline())
+        reallocate(size_);
+}
+
+// --------------------------------------- модификаторы -------------------------------------
+
+// два буфера в куче меняются указателями. Два встроенных — общая часть
+// обменивается поэлементно, остаток длинного переносится в короткий.
+// Встроенный с кучей — элементы встроенного переносятся во встроенный
+// буфер второго, а он отдаёт свой указатель
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::swap(small_vector& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value) {
+    if (this == &other)
+        return;
+    if (!isInline() && !other.isInline()) {
+        std::swap(data_, other.data_);
+        std::swap(capacity_, other.capacity_);
+    } else if (isInline() && other.isInline()) {
+        small_vector& shorter = size_ <= other.size_ ? *this : other;
+        small_vector& longer = size_ <= other.size_ ? other : *this;
+        std::swap_ranges(shorter.data_, shorter.data_ + shorter.size_, longer.data_);
+        relocate(longer.data_ + shorter.size_, longer.data_ + longer.size_, shorter.data_ + shorter.size_);
+        destroyRange(longer.data_ + shorter.size_, longer.data_ + longer.size_);
+    } else {
+        small_vector& onStack = isInline() ? *this : other;
+        small_vector& onHeap = isInline() ? other : *this;
+        relocate(onStack.data_, onStack.data_ + onStack.size_, onHeap.inlineData());
+        destroyRange(onStack.data_, onStack.data_ + onStack.size_);
+        onStack.data_ = onHeap.data_;
+        onStack.capacity_ = onHeap.capacity_;
+        onHeap.data_ = onHeap.inlineData();
+        onHeap.capacity_ = N;
+    }
+    std::swap(size_, other.size_);
+    if (alloc_traits::propagate_on_container_swap::value)
+        std::swap(alloc_, other.alloc_);
+}
+
+// ------------------------------------- работа с памятью -------------------------------------
+
+// v остаётся пустым во встроенном буфере; *this перед вызовом пуст и
+// во встроенном буфере, аллокаторы равны
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::stealFrom(small_vector& v) {
+    if (v.isInline()) {
+        if constexpr (kCopyWholeInline)
+            std::memcpy(inline_, v.inline_, sizeof(inline_));
+        else
+            relocate(v.data_, v.data_ + v.size_, data_);
+        size_ = v.size_;
+        v.clear();
+    } else {
+        data_ = v.data_;
+        size_ = v.size_;
+        capacity_ = v.capacity_;
+        v.data_ = v.inlineData();
+        v.size_ = 0;
+        v.capacity_ = N;
+    }
+}
+
+// newCapacity <= N — возврат во встроенный буфер (из shrink_to_fit)
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::reallocate(size_type newCapacity) {
+    const bool toInline = newCapacity <= N;
+    T* newData = toInline ? inlineData() : alloc_traits::allocate(alloc_, newCapacity);
+    try {
+        relocate(data_, data_ + size_, newData);
+    } catch (...) {
+        if (!toInline)
+            alloc_traits::deallocate(alloc_, newData, newCapacity);
+        throw;
+    }
+    destroyRange(data_, data_ + size_);
+    deallocate();
+    if (!toInline) {
+        data_ = newData;
+        capacity_ = newCapacity;
+    }
+}
+
+// освобождает буфер в куче и возвращает вектор во встроенный
+template <typename T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::deallocate() noexcept {
+    if (!isInline()) {
+        alloc_traits::deallocate(alloc_, data_, capacity_);
+        data_ = inlineData();
+        capacity_ = N;
+    }
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_SMALL_VECTOR_H
@@ -0,0 +1,175 @@
+#ifndef S21_CONTAINERS_SPSC_QUEUE_H
+#define S21_CONTAINERS_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "cache_line.h"
+
+namespace s21 {
+
+// Ограниченная очередь для ровно одного производителя и одного потребителя.
+// Без блокировок и без ожидания: каждая операция — несколько обращений к
+// своим полям и одно атомарное сохранение. Индексы растут без ограничения,
+// слот — индекс по маске ёмкости (степень двойки).
+// Счётчики производителя и потребителя лежат на разных строках кэша; каждый
+// поток держит у себя копию чужого счётчика и перечитывает её, только когда
+// по копии очередь выглядит полной (пустой) — так строки не гоняются между
+// ядрами на каждой операции
+template <typename T, typename Allocator = std::allocator<T>>
+class spsc_queue {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using allocator_type = Allocator;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    explicit spsc_queue(size_type capacity, const allocator_type& alloc = allocator_type());
+    spsc_queue(const spsc_queue&) = delete;
+    spsc_queue& operator=(const spsc_queue&) = delete;
+    ~spsc_queue();
+
+    // ------------------- ёмкость -------------------
+    size_type capacity() const noexcept { return mask_ + 1; }
+    // точны, только пока оба потока стоят; иначе — снимок на момент чтения
+    size_type size_approx() const noexcept { return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire); }
+    bool empty_approx() const noexcept { return size_approx() == 0; }
+
+    // ------------------- производитель -------------------
+    bool try_push(const T& value) { return try_emplace(value); }
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+    template <typename... Args>
+    bool try_emplace(Args&&... args);
+    // кладёт сколько влезет из [first, first + count), возвращает сколько положил;
+    // хвост публикуется одним сохранением на всю пачку
+    template <typename InputIt>
+    size_type push_bulk(InputIt first, size_type count);
+
+    // ------------------- потребитель -------------------
+    bool try_pop(T& value);
+    // забирает до count элементов в out, возвращает сколько забрал
+    template <typename OutputIt>
+    size_type pop_bulk(OutputIt out, size_type count);
+
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    // только для чтения после конструктора
+    T* slots_ = nullptr;
+    size_type mask_ = 0;
+    Allocator alloc_;
+
+    // строка производителя
+    alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+    size_type headCache_ = 0;
+
+    // строка потребителя
+    alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+    size_type tailCache_ = 0;
+};
+
+template <typename T, typename Allocator>
+spsc_queue<T, Allocator>::spsc_queue(size_type capacity, const allocator_type& alloc) : alloc_(alloc) {
+    if (capacity == 0 || capacity > alloc_traits::max_size(alloc_) / 2)
+        throw std::length_error("Invalid spsc_queue capacity");
+    size_type rounded = 1;
+    while (rounded < capacity)
+        rounded *= 2;
+    slots_ = alloc_traits::allocate(alloc_, rounded);
+    mask_ = rounded - 1;
+}
+
+// к деструктору оба потока уже закончили работу
+template <typename T, typename Allocator>
+spsc_queue<T, Allocator>::~spsc_queue() {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type index = head_.load(std::memory_order_relaxed); index != tail; ++index)
+        alloc_traits::destroy(alloc_, slots_ + (index & mask_));
+    alloc_traits::deallocate(alloc_, slots_, mask_ + 1);
+}
+
+// если конструктор элемента бросит, хвост не сдвинут и очередь не изменилась
+template <typename T, typename Allocator>
+template <typename... Args>
+bool spsc_queue<T, Allocator>::try_emplace(Args&&... args) {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - headCache_ > mask_) {
+        headCache_ = head_.load(std::memory_order_acquire);
+        if (tail - headCache_ > mask_)
+            return false;
+    }
+    alloc_traits::construct(alloc_, slots_ + (tail & mask_), std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt>
+typename spsc_queue<T, Allocator>::size_type spsc_queue<T, Allocator>::push_bulk(InputIt first, size_type count) {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    size_type room = capacity() - (tail - headCache_);
+    if (room < count) {
+        headCache_ = head_.load(std::memory_order_acquire);
+        room = capacity() - (tail - headCache_);
+    }
+    const size_type batch = room < count ? room : count;
+    size_type done = 0;
+    try {
+        for (; done < batch; ++done, ++first)
+            alloc_traits::construct(alloc_, slots_ + ((tail + done) & mask_), *first);
+    } catch (...) {
+        // построенное публикуется, бросивший элемент и остаток — нет
+        tail_.store(tail + done, std::memory_order_release);
+        throw;
+    }
+    tail_.store(tail + batch, std::memory_order_release);
+    return batch;
+}
+
+template <typename T, typename Allocator>
+bool spsc_queue<T, Allocator>::try_pop(T& value) {
+    const size_type head = head_.load(std::memory_order_relaxed);
+    if (head == tailCache_) {
+        tailCache_ = tail_.load(std::memory_order_acquire);
+        if (head == tailCache_)
+            return false;
+    }
+    T* slot = slots_ + (head & mask_);
+    value = std::move(*slot);
+    alloc_traits::destroy(alloc_, slot);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+template <typename OutputIt>
+typename spsc_queue<T, Allocator>::size_type spsc_queue<T, Allocator>::pop_bulk(OutputIt out, size_type count) {
+    const size_type head = head_.load(std::memory_order_relaxed);
+    size_type ready = tailCache_ - head;
+    if (ready < count) {
+        tailCache_ = tail_.load(std::memory_order_acquire);
+        ready = tailCache_ - head;
+    }
+    const size_type batch = ready < count ? ready : count;
+    size_type done = 0;
+    try {
+        for (; done < batch; ++done, ++out) {
+            T* slot = slots_ + ((head + done) & mask_);
+            *out = std::move(*slot);
+            alloc_traits::destroy(alloc_, slot);
+        }
+    } catch (...) {
+        // уже отданные освобождаются, элемент, на котором бросило, остаётся
+        head_.store(head + done, std::memory_order_release);
+        throw;
+    }
+    head_.store(head + batch, std::memory_order_release);
+    return batch;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_SPSC_QUEUE_H
@@ -0,0 +1,59 @@
+#ifndef S21_CONTAINERS_STACK_H
+#define S21_CONTAINERS_STACK_H
+
+#include <initializer_list>
+#include <utility>
+
+#include "ring_buffer.h"
+
+namespace s21 {
+
+// Стек LIFO поверх любого контейнера с push_back/pop_back/back
+// (ring_buffer, vector, list). Вершина — конец контейнера
+template <typename T, typename Container = ring_buffer<T>>
+class stack {
+public:
+    using container_type = Container;
+    using value_type = typename Container::value_type;
+    using reference = typename Container::reference;
+    using const_reference = typename Container::const_reference;
+    using size_type = typename Container::size_type;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    stack() = default;
+    explicit stack(const Container& container) : c_(container) {}
+    explicit stack(Container&& container) : c_(std::move(container)) {}
+    stack(std::initializer_list<value_type> const &items) : c_(items) {}
+    stack(const stack &s) = default;
+    stack(stack &&s) = default;
+    ~stack() = default;
+
+    stack& operator=(const stack &s) = default;
+    stack& operator=(stack &&s) = default;
+
+    // -------------------  доступ к элементам -------------------
+    reference top() { return c_.back(); }
+    const_reference top() const { return c_.back(); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const { return c_.empty(); }
+    size_type size() const { return c_.size(); }
+
+    // ------------------- модификаторы -------------------
+    void push(const_reference value) { c_.push_back(value); }
+    void push(value_type&& value) { c_.push_back(std::move(value)); }
+    template <typename... Args>
+    void emplace(Args&&... args) { c_.emplace_back(std::forward<Args>(args)...); }
+    void pop() { c_.pop_back(); }
+    void swap(stack& other) noexcept { c_.swap(other.c_); }
+    // appends new elements to the top of the stack; the last argument ends up on top
+    template <typename... Args>
+    void insert_many_front(Args&&... args) { (c_.emplace_back(std::forward<Args>(args)), ...); }
+
+private:
+    Container c_;
+};
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_STACK_H
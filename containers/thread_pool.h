@@ -0,0 +1,271 @@
+#ifndef S21_CONTAINERS_THREAD_POOL_H
+#define S21_CONTAINERS_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cache_line.h"
+
+namespace s21 {
+
+// Пул потоков с воровством задач для параллельных алгоритмов библиотеки
+// (fork-join). У каждого участника своя очередь: свои задачи он берёт с
+// хвоста — последняя отложенная ещё горячая в кэше, — а чужие ворует с
+// головы, где лежат самые крупные куски работы. Поток, ждущий отложенную
+// задачу, не засыпает, а выполняет любые другие, поэтому вложенные invoke
+// не блокируют пул.
+// concurrency() — сколько потоков считают одновременно: рабочие плюс
+// вызывающий, так что thread_pool(1) потоков не заводит и всё делает на месте
+class thread_pool {
+public:
+    using size_type = std::size_t;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    explicit thread_pool(size_type concurrency = defaultConcurrency());
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+    ~thread_pool();
+
+    size_type concurrency() const noexcept { return queues_.size(); }
+    // общий пул на все ядра машины, создаётся при первом обращении
+    static thread_pool& shared();
+
+    // ------------------- fork-join -------------------
+    // выполняет first и second, возможно параллельно, и возвращается, когда
+    // закончатся обе. Исключение пробрасывается вызывающему, если бросили
+    // обе — исключение first
+    template <typename First, typename Second>
+    void invoke(First&& first, Second&& second);
+    // body(i) для каждого i из [first, last): диапазон делится пополам через invoke
+    template <typename Body>
+    void parallel_for(size_type first, size_type last, Body&& body);
+
+private:
+    // задача живёт на стеке того, кто её отложил, и нужна ему до done
+    struct Task {
+        explicit Task(void (*call)(Task*)) noexcept : run(call) {}
+
+        void (*run)(Task*);
+        std::atomic<bool> done{false};
+        std::exception_ptr error;
+    };
+
+    template <typename Function>
+    struct BoundTask : Task {
+        explicit BoundTask(Function& f) noexcept : Task(&BoundTask::call), function(f) {}
+
+        // после done владелец может уничтожить задачу — дальше её не трогаем
+        static void call(Task* base) {
+            BoundTask* self = static_cast<BoundTask*>(base);
+            try {
+                self->function();
+            } catch (...) {
+                self->error = std::current_exception();
+            }
+            self->done.store(true, std::memory_order_release);
+        }
+
+        Function& function;
+    };
+
+    struct alignas(kCacheLineSize) Queue {
+        std::mutex mutex;
+        std::deque<Task*> tasks;
+    };
+
+    // какому пулу и какой очереди принадлежит текущий поток
+    struct Participant {
+        const thread_pool* pool = nullptr;
+        size_type queue = 0;
+    };
+
+    static size_type defaultConcurrency() noexcept;
+    static Participant& currentParticipant() noexcept;
+    // очередь 0 общая для всех потоков вне пула, 1.. — рабочих
+    size_type currentQueue() const noexcept;
+
+    void push(Task* task, size_type home);
+    Task* take(size_type home);
+    bool runOne(size_type home);
+    void wait(Task& task, size_type home);
+    void workerLoop(size_type queue);
+    void stopWorkers() noexcept;
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+    // pending_ растёт под sleepMutex_ до того, как задача попадёт в очередь,
+    // поэтому рабочий не уснёт, пропустив её
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    std::atomic<size_type> pending_{0};
+    bool stop_ = false;
+};
+
+// ------------------------------------- конструкторы и деструкторы -------------------------------------
+
+inline thread_pool::thread_pool(size_type concurrency) {
+    concurrency = std::max<size_type>(concurrency, 1);
+    queues_.reserve(concurrency);
+    for (size_type i = 0; i < concurrency; ++i)
+        queues_.push_back(std::make_unique<Queue>());
+    workers_.reserve(concurrency - 1);
+    try {
+        for (size_type i = 1; i < concurrency; ++i)
+            workers_.emplace_back([this, i] { workerLoop(i); });
+    } catch (...) {
+        stopWorkers();
+        throw;
+    }
+}
+
+inline thread_pool::~thread_pool() {
+    stopWorkers();
+}
+
+inline thread_pool& thread_pool::shared() {
+    static thread_pool pool;
+    return pool;
+}
+
+inline thread_pool::size_type thread_pool::defaultConcurrency() noexcept {
+    return std::max<size_type>(std::thread::hardware_concurrency(), 1);
+}
+
+inline void thread_pool::stopWorkers() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& worker : workers_)
+        worker.join();
+    workers_.clear();
+}
+
+// ------------------------------------- fork-join -------------------------------------
+
+// second откладывается в очередь текущего потока, first выполняется сразу.
+// Если second никто не украл, ожидающий сам снимет его с хвоста своей очереди
+template <typename First, typename Second>
+void thread_pool::invoke(First&& first, Second&& second) {
+    if (queues_.size() == 1) {
+        first();
+        second();
+        return;
+    }
+    const size_type home = currentQueue();
+    BoundTask<typename std::remove_reference<Second>::type> task(second);
+    push(&task, home);
+    std::exception_ptr error;
+    try {
+        first();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    wait(task, home);
+    if (!error)
+        error = task.error;
+    if (error)
+        std::rethrow_exception(error);
+}
+
+template <typename Body>
+void thread_pool::parallel_for(size_type first, size_type last, Body&& body) {
+    if (first >= last)
+        return;
+    if (last - first == 1) {
+        body(first);
+        return;
+    }
+    const size_type middle = first + (last - first) / 2;
+    invoke([&] { parallel_for(first, middle, body); }, [&] { parallel_for(middle, last, body); });
+}
+
+// ------------------------------------- очереди задач -------------------------------------
+
+inline thread_pool::Participant& thread_pool::currentParticipant() noexcept {
+    static thread_local Participant participant;
+    return participant;
+}
+
+inline thread_pool::size_type thread_pool::currentQueue() const noexcept {
+    const Participant& participant = currentParticipant();
+    return participant.pool == this ? participant.queue : 0;
+}
+
+inline void thread_pool::push(Task* task, size_type home) {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues_[home]->mutex);
+        queues_[home]->tasks.push_back(task);
+    }
+    wake_.notify_one();
+}
+
+// своя очередь — с хвоста, чужие — с головы, начиная со следующей
+inline thread_pool::Task* thread_pool::take(size_type home) {
+    Task* task = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(queues_[home]->mutex);
+        if (!queues_[home]->tasks.empty()) {
+            task = queues_[home]->tasks.back();
+            queues_[home]->tasks.pop_back();
+        }
+    }
+    for (size_type i = 1; task == nullptr && i < queues_.size(); ++i) {
+        Queue& victim = *queues_[(home + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+        }
+    }
+    if (task != nullptr)
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+    return task;
+}
+
+inline bool thread_pool::runOne(size_type home) {
+    Task* task = take(home);
+    if (task == nullptr)
+        return false;
+    task->run(task);
+    return true;
+}
+
+// пока отложенная задача не готова, помогаем пулу
+inline void thread_pool::wait(Task& task, size_type home) {
+    while (!task.done.load(std::memory_order_acquire)) {
+        if (!runOne(home))
+            std::this_thread::yield();
+    }
+}
+
+inline void thread_pool::workerLoop(size_type queue) {
+    currentParticipant() = Participant{this, queue};
+    for (;;) {
+        if (runOne(queue))
+            continue;
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wake_.wait(lock, [this] { return stop_ || pending_.load(std::memory_order_relaxed) != 0; });
+        if (stop_)
+            return;
+    }
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_THREAD_POOL_H
@@ -0,0 +1,1083 @@
+#ifndef S21_CONTAINERS_TREE_H
+#define S21_CONTAINERS_TREE_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// Красно-чёрное дерево — общий движок map, set и multiset.
+// Как и в list, дерево хранит узел-страж header_ без данных:
+// header_.parent — корень, header_.left — минимальный узел,
+// header_.right — максимальный. end() указывает на страж, поэтому
+// begin() и --end() берутся за O(1). Страж всегда красный, а корень
+// всегда чёрный — по этому декремент отличает end() от корня.
+
+// связи и цвет узла; балансировка от типа значения не зависит, поэтому
+// функции ниже не шаблонные и не размножаются для каждого контейнера
+struct TreeNodeBase {
+    TreeNodeBase* parent;
+    TreeNodeBase* left;
+    TreeNodeBase* right;
+    bool red;
+};
+
+inline TreeNodeBase* treeMinimum(TreeNodeBase* node) {
+    while (node->left != nullptr)
+        node = node->left;
+    return node;
+}
+
+inline TreeNodeBase* treeMaximum(TreeNodeBase* node) {
+    while (node->right != nullptr)
+        node = node->right;
+    return node;
+}
+
+inline const TreeNodeBase* treeIncrement(const TreeNodeBase* node) {
+    if (node->right != nullptr)
+        return treeMinimum(node->right);
+    const TreeNodeBase* parent = node->parent;
+    while (node == parent->right) {
+        node = parent;
+        parent = parent->parent;
+    }
+    // выход за максимум: node == корень, parent == страж. Единственный
+    // узел дерева — особый случай, там корень и есть header_.right
+    if (node->right != parent)
+        node = parent;
+    return node;
+}
+
+inline const TreeNodeBase* treeDecrement(const TreeNodeBase* node) {
+    // --end(): у стража parent->parent снова страж
+    if (node->red && node->parent->parent == node)
+        return node->right;
+    if (node->left != nullptr)
+        return treeMaximum(node->left);
+    const TreeNodeBase* parent = node->parent;
+    while (node == parent->left) {
+        node = parent;
+        parent = parent->parent;
+    }
+    return parent;
+}
+
+inline TreeNodeBase* treeIncrement(TreeNodeBase* node) {
+    return const_cast<TreeNodeBase*>(treeIncrement(static_cast<const TreeNodeBase*>(node)));
+}
+
+inline TreeNodeBase* treeDecrement(TreeNodeBase* node) {
+    return const_cast<TreeNodeBase*>(treeDecrement(static_cast<const TreeNodeBase*>(node)));
+}
+
+inline void treeRotateLeft(TreeNodeBase* node, TreeNodeBase*& root) {
+    TreeNodeBase* pivot = node->right;
+    node->right = pivot->left;
+    if (pivot->left != nullptr)
+        pivot->left->parent = node;
+    pivot->parent = node->parent;
+    if (node == root)
+        root = pivot;
+    else if (node == node->parent->left)
+        node->parent->left = pivot;
+    else
+        node->parent->right = pivot;
+    pivot->left = node;
+    node->parent = pivot;
+}
+
+inline void treeRotateRight(TreeNodeBase* node, TreeNodeBase*& root) {
+    TreeNodeBase* pivot = node->left;
+    node->left = pivot->right;
+    if (pivot->right != nullptr)
+        pivot->right->parent = node;
+    pivot->parent = node->parent;
+    if (node == root)
+        root = pivot;
+    else if (node == node->parent->right)
+        node->parent->right = pivot;
+    else
+        node->parent->left = pivot;
+    pivot->right = node;
+    node->parent = pivot;
+}
+
+// подвешивает node к parent слева или справа, обновляет крайние узлы
+// стража и восстанавливает свойства дерева
+inline void treeInsertAndRebalance(bool left, TreeNodeBase* node, TreeNodeBase* parent, TreeNodeBase& header) {
+    TreeNodeBase*& root = header.parent;
+    node->parent = parent;
+    node->left = nullptr;
+    node->right = nullptr;
+    node->red = true;
+
+    if (left) {
+        parent->left = node;  // для пустого дерева это header.left
+        if (parent == &header) {
+            header.parent = node;
+            header.right = node;
+        } else if (parent == header.left) {
+            header.left = node;
+        }
+    } else {
+        parent->right = node;
+        if (parent == header.right)
+            header.right = node;
+    }
+
+    while (node != root && node->parent->red) {
+        TreeNodeBase* grandparent = node->parent->parent;
+        if (node->parent == grandparent->left) {
+            TreeNodeBase* uncle = grandparent->right;
+            if (uncle != nullptr && uncle->red) {
+                node->parent->red = false;
+                uncle->red = false;
+                grandparent->red = true;
+                node = grandparent;
+            } else {
+                if (node == node->parent->right) {
+                    node = node->parent;
+                    treeRotateLeft(node, root);
+                }
+                node->parent->red = false;
+                grandparent->red = true;
+                treeRotateRight(grandparent, root);
+            }
+        } else {
+            TreeNodeBase* uncle = grandparent->left;
+            if (uncle != nullptr && uncle->red) {
+                node->parent->red = false;
+                uncle->red = false;
+                grandparent->red = true;
+                node = grandparent;
+            } else {
+                if (node == node->parent->left) {
+                    node = node->parent;
+                    treeRotateRight(node, root);
+                }
+                node->parent->red = false;
+                grandparent->red = true;
+                treeRotateLeft(grandparent, root);
+            }
+        }
+    }
+    root->red = false;
+}
+
+// вынимает node из дерева и восстанавливает балансировку. Узел с двумя
+// детьми меняется местами со своим преемником (перевешиванием связей,
+// значения не копируются), так что итераторы на остальные узлы остаются
+// действительными. Возвращает вынутый узел — освобождает его вызывающий
+inline TreeNodeBase* treeRebalanceForErase(TreeNodeBase* node, TreeNodeBase& header) {
+    TreeNodeBase*& root = header.parent;
+    TreeNodeBase*& leftmost = header.left;
+    TreeNodeBase*& rightmost = header.right;
+    TreeNodeBase* successor = node;
+    TreeNodeBase* child = nullptr;
+    TreeNodeBase* childParent = nullptr;
+
+    if (successor->left == nullptr)
+        child = successor->right;
+    else if (successor->right == nullptr)
+        child = successor->left;
+    else {
+        successor = treeMinimum(successor->right);
+        child = successor->right;
+    }
+
+    if (successor != node) {
+        // преемник встаёт на место node
+        node->left->parent = successor;
+        successor->left = node->left;
+        if (successor != node->right) {
+            childParent = successor->parent;
+            if (child != nullptr)
+                child->parent = successor->parent;
+            successor->parent->left = child;
+            successor->right = node->right;
+            node->right->parent = successor;
+        } else {
+            childParent = successor;
+        }
+        if (root == node)
+            root = successor;
+        else if (node->parent->left == node)
+            node->parent->left = successor;
+        else
+            node->parent->right = successor;
+        successor->parent = node->parent;
+        std::swap(successor->red, node->red);
+        successor = node;  // дальше successor — удаляемый узел
+    } else {
+        childParent = successor->parent;
+        if (child != nullptr)
+            child->parent = successor->parent;
+        if (root == node)
+            root = child;
+        else if (node->parent->left == node)
+            node->parent->left = child;
+        else
+            node->parent->right = child;
+        if (leftmost == node)
+            leftmost = node->right == nullptr ? node->parent : treeMinimum(child);
+        if (rightmost == node)
+            rightmost = node->left == nullptr ? node->parent : treeMaximum(child);
+    }
+
+    if (!successor->red) {
+        while (child != root && (child == nullptr || !child->red)) {
+            if (child == childParent->left) {
+                TreeNodeBase* sibling = childParent->right;
+                if (sibling->red) {
+                    sibling->red = false;
+                    childParent->red = true;
+                    treeRotateLeft(childParent, root);
+                    sibling = childParent->right;
+                }
+                if ((sibling->left == nullptr || !sibling->left->red) &&
+                    (sibling->right == nullptr || !sibling->right->red)) {
+                    sibling->red = true;
+                    child = childParent;
+                    childParent = childParent->parent;
+                } else {
+                    if (sibling->right == nullptr || !sibling->right->red) {
+                        sibling->left->red = false;
+                        sibling->red = true;
+                        treeRotateRight(sibling, root);
+                        sibling = childParent->right;
+                    }
+                    sibling->red = childParent->red;
+                    childParent->red = false;
+                    if (sibling->right != nullptr)
+                        sibling->right->red = false;
+                    treeRotateLeft(childParent, root);
+                    break;
+                }
+            } else {
+                TreeNodeBase* sibling = childParent->left;
+                if (sibling->red) {
+                    sibling->red = false;
+                    childParent->red = true;
+                    treeRotateRight(childParent, root);
+                    sibling = childParent->left;
+                }
+                if ((sibling->right == nullptr || !sibling->right->red) &&
+                    (sibling->left == nullptr || !sibling->left->red)) {
+                    sibling->red = true;
+                    child = childParent;
+                    childParent = childParent->parent;
+                } else {
+                    if (sibling->left == nullptr || !sibling->left->red) {
+                        sibling->right->red = false;
+                        sibling->red = true;
+                        treeRotateLeft(sibling, root);
+                        sibling = childParent->left;
+                    }
+                    sibling->red = childParent->red;
+                    childParent->red = false;
+                    if (sibling->left != nullptr)
+                        sibling->left->red = false;
+                    treeRotateRight(childParent, root);
+                    break;
+                }
+            }
+        }
+        if (child != nullptr)
+            child->red = false;
+    }
+    return successor;
+}
+
+// KeyOfValue достаёт ключ из хранимого значения: для set это само
+// значение, для map — first. Уникальность ключей выбирает контейнер,
+// вызывая *Unique или *Equal варианты вставки
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+class tree {
+public:
+    class TreeIterator;
+    class TreeConstIterator;
+
+    using key_type = Key;
+    using value_type = Value;
+    using reference = Value&;
+    using const_reference = const Value&;
+    using iterator = TreeIterator;
+    using const_iterator = TreeConstIterator;
+    using size_type = size_t;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    tree() = default;
+    explicit tree(const Compare& comp, const allocator_type& alloc = allocator_type()) : comp_(comp), alloc_(alloc) {}
+    tree(const tree& other);
+    tree(tree&& other) noexcept;
+    ~tree() { clear(); }
+
+    tree& operator=(const tree& other);
+    tree& operator=(tree&& other);
+
+    // ------------------- итераторы и ёмкость -------------------
+    iterator begin() noexcept { return iterator(header_.left); }
+    iterator end() noexcept { return iterator(&header_); }
+    const_iterator begin() const noexcept { return const_iterator(header_.left); }
+    const_iterator end() const noexcept { return const_iterator(&header_); }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type max_size() const noexcept { return node_traits::max_size(alloc_); }
+    key_compare key_comp() const { return comp_; }
+    allocator_type get_allocator() const { return allocator_type(alloc_); }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept;
+
+    // узел создаётся только если ключа ещё нет
+    template <typename V>
+    std::pair<iterator, bool> insertUnique(V&& value);
+    template <typename V>
+    iterator insertEqual(V&& value);
+
+    // emplace не знает ключа до постройки значения, поэтому сначала
+    // создаёт узел и освобождает его, если ключ уже занят
+    template <typename... Args>
+    std::pair<iterator, bool> emplaceUnique(Args&&... args);
+    template <typename... Args>
+    iterator emplaceEqual(Args&&... args);
+
+    // верная подсказка — узел, перед которым встанет новый: тогда
+    // место находится за O(1) амортизированно, иначе обычный спуск
+    template <typename... Args>
+    iterator emplaceHintUnique(const_iterator hint, Args&&... args);
+    template <typename... Args>
+    iterator emplaceHintEqual(const_iterator hint, Args&&... args);
+
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    size_type erase(const key_type& key);
+    // в уникальном дереве равный ключ один: один спуск вместо equal_range
+    size_type eraseUnique(const key_type& key);
+    void swap(tree& other) noexcept;
+
+    // переносит в это дерево узлы other (для уникального дерева — только
+    // с отсутствующими здесь ключами). При равных аллокаторах узлы
+    // перевешиваются без копирования значений
+    void mergeUnique(tree& other);
+    void mergeEqual(tree& other);
+
+    // ------------------- поиск -------------------
+    iterator find(const key_type& key);
+    const_iterator find(const key_type& key) const;
+    iterator lower_bound(const key_type& key) { return iterator(lowerBound(key)); }
+    const_iterator lower_bound(const key_type& key) const { return const_iterator(lowerBound(key)); }
+    iterator upper_bound(const key_type& key) { return iterator(upperBound(key)); }
+    const_iterator upper_bound(const key_type& key) const { return const_iterator(upperBound(key)); }
+    std::pair<iterator, iterator> equal_range(const key_type& key);
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const;
+    size_type count(const key_type& key) const;
+    bool contains(const key_type& key) const { return find(key) != end(); }
+
+    // проверка свойств красно-чёрного дерева, порядка ключей, связей
+    // и стража — для тестов
+    bool verify() const;
+
+private:
+    class Node;
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    // куда подвесить новый узел. parent == nullptr — в уникальном дереве
+    // такой ключ уже есть, он лежит в existing
+    struct InsertPos {
+        TreeNodeBase* parent;
+        bool left;
+        TreeNodeBase* existing;
+    };
+
+    template <typename... Args>
+    Node* createNode(Args&&... args);
+    void destroyNode(TreeNodeBase* node) noexcept;
+    static const key_type& keyOf(const TreeNodeBase* node) { return KeyOfValue()(static_cast<const Node*>(node)->data); }
+
+    InsertPos uniquePos(const key_type& key);
+    InsertPos equalPos(const key_type& key);
+    InsertPos hintUniquePos(const_iterator hint, const key_type& key);
+    InsertPos hintEqualPos(const_iterator hint, const key_type& key);
+    iterator link(const InsertPos& pos, TreeNodeBase* node);
+    TreeNodeBase* extract(TreeNodeBase* node);
+
+    TreeNodeBase* lowerBound(const key_type& key) const;
+    TreeNodeBase* upperBound(const key_type& key) const;
+
+    TreeNodeBase* copySubtree(const TreeNodeBase* node, TreeNodeBase* parent);
+    void eraseSubtree(TreeNodeBase* node) noexcept;
+    void copyFrom(const tree& other);
+
+    void resetHeader() noexcept;
+    void stealNodes(tree& other) noexcept;
+
+    // страж перевешивается при обмене/переносе, поэтому mutable-указатель
+    // на него из const-методов берём через эту функцию
+    TreeNodeBase* header() const noexcept { return const_cast<TreeNodeBase*>(&header_); }
+
+    TreeNodeBase header_{nullptr, &header_, &header_, true};
+    size_type size_ = 0;
+    Compare comp_;
+    node_allocator alloc_;
+};
+
+// --------------------------------------- классы ------------------------------------------
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+class tree<Key, Value, KeyOfValue, Compare, Allocator>::Node : public TreeNodeBase {
+public:
+    value_type data;
+
+    template <typename... Args>
+    explicit Node(Args&&... args) : TreeNodeBase{nullptr, nullptr, nullptr, true}, data(std::forward<Args>(args)...) {}
+};
+
+// итератор — один указатель на узел, переходы идут по связям дерева
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+class tree<Key, Value, KeyOfValue, Compare, Allocator>::TreeIterator {
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    TreeIterator(TreeNodeBase* node = nullptr) : current(node) {}
+
+    Value& operator*() const { return static_cast<Node*>(current)->data; }
+    Value* operator->() const { return &static_cast<Node*>(current)->data; }
+
+    TreeIterator& operator++() {
+        current = treeIncrement(current);
+        return *this;
+    }
+
+    // постфиксный
+    TreeIterator operator++(int) {
+        TreeIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    TreeIterator& operator--() {
+        current = treeDecrement(current);
+        return *this;
+    }
+
+    // постфиксный
+    TreeIterator operator--(int) {
+        TreeIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const TreeIterator& other) const { return current == other.current; }
+    bool operator!=(const TreeIterator& other) const { return current != other.current; }
+
+    TreeNodeBase* current;
+};
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+class tree<Key, Value, KeyOfValue, Compare, Allocator>::TreeConstIterator {
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Value*;
+    using reference = const Value&;
+
+    TreeConstIterator(const TreeNodeBase* node = nullptr) : current(node) {}
+    TreeConstIterator(const TreeIterator& iter) : current(iter.current) {}
+
+    const Value& operator*() const { return static_cast<const Node*>(current)->data; }
+    const Value* operator->() const { return &static_cast<const Node*>(current)->data; }
+
+    TreeConstIterator& operator++() {
+        current = treeIncrement(current);
+        return *this;
+    }
+
+    TreeConstIterator operator++(int) {
+        TreeConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    TreeConstIterator& operator--() {
+        current = treeDecrement(current);
+        return *this;
+    }
+
+    TreeConstIterator operator--(int) {
+        TreeConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    // свободные функции, чтобы сравнивать iterator с const_iterator в любом порядке
+    friend bool operator==(const TreeConstIterator& lhs, const TreeConstIterator& rhs) { return lhs.current == rhs.current; }
+    friend bool operator!=(const TreeConstIterator& lhs, const TreeConstIterator& rhs) { return lhs.current != rhs.current; }
+
+    const TreeNodeBase* current;
+};
+
+// ------------------------------------- конструкторы и присваивания -------------------------------------
+
+// копия повторяет форму исходного дерева узел в узел, без сравнений и балансировки
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+tree<Key, Value, KeyOfValue, Compare, Allocator>::tree(const tree& other)
+    : comp_(other.comp_), alloc_(node_traits::select_on_container_copy_construction(other.alloc_)) {
+    copyFrom(other);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+tree<Key, Value, KeyOfValue, Compare, Allocator>::tree(tree&& other) noexcept : comp_(other.comp_), alloc_(other.alloc_) {
+    stealNodes(other);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+tree<Key, Value, KeyOfValue, Compare, Allocator>& tree<Key, Value, KeyOfValue, Compare, Allocator>::operator=(const tree& other) {
+    if (this == &other) return *this;
+    clear();
+    if (node_traits::propagate_on_container_copy_assignment::value)
+        alloc_ = other.alloc_;
+    comp_ = other.comp_;
+    copyFrom(other);
+    return *this;
+}
+
+// как в list: при разных аллокаторах без propagate узлы чужие, переносим значения
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+tree<Key, Value, KeyOfValue, Compare, Allocator>& tree<Key, Value, KeyOfValue, Compare, Allocator>::operator=(tree&& other) {
+    if (this == &other) return *this;
+    clear();
+    comp_ = other.comp_;
+    if (node_traits::propagate_on_container_move_assignment::value)
+        alloc_ = other.alloc_;
+    else if (!(alloc_ == other.alloc_)) {
+        for (auto it = other.begin(); it != other.end(); ++it)
+            emplaceHintEqual(end(), std::move(*it));
+        other.clear();
+        return *this;
+    }
+    stealNodes(other);
+    return *this;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+void tree<Key, Value, KeyOfValue, Compare, Allocator>::copyFrom(const tree& other) {
+    if (other.header_.parent == nullptr) return;
+    TreeNodeBase* root = copySubtree(other.header_.parent, &header_);
+    header_.parent = root;
+    header_.left = treeMinimum(root);
+    header_.right = treeMaximum(root);
+    size_ = other.size_;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+void tree<Key, Value, KeyOfValue, Compare, Allocator>::resetHeader() noexcept {
+    header_.parent = nullptr;
+    header_.left = header_.right = &header_;
+    size_ = 0;
+}
+
+// страж встроен в объект, поэтому корень нужно перевесить на свой header_
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+void tree<Key, Value, KeyOfValue, Compare, Allocator>::stealNodes(tree& other) noexcept {
+    if (other.header_.parent == nullptr) {
+        resetHeader();
+        return;
+    }
+    header_.parent = other.header_.parent;
+    header_.left = other.header_.left;
+    header_.right = other.header_.right;
+    header_.parent->parent = &header_;
+    size_ = other.size_;
+    other.resetHeader();
+}
+
+// --------------------------------------- узлы -------------------------------------
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+template <typename... Args>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::Node* tree<Key, Value, KeyOfValue, Compare, Allocator>::createNode(Args&&... args) {
+    Node* node = node_traits::allocate(alloc_, 1);
+    try {
+        node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+        node_traits::deallocate(alloc_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+void tree<Key, Value, KeyOfValue, Compare, Allocator>::destroyNode(TreeNodeBase* node) noexcept {
+    Node* valueNode = static_cast<Node*>(node);
+    node_traits::destroy(alloc_, valueNode);
+    node_traits::deallocate(alloc_, valueNode, 1);
+}
+
+// рекурсия только по правым поддеревьям, левая ветка идёт циклом;
+// при исключении уже скопированная часть освобождается
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+TreeNodeBase* tree<Key, Value, KeyOfValue, Compare, Allocator>::copySubtree(const TreeNodeBase* node, TreeNodeBase* parent) {
+    Node* top = createNode(static_cast<const Node*>(node)->data);
+    top->red = node->red;
+    top->parent = parent;
+    try {
+        if (node->right != nullptr)
+            top->right = copySubtree(node->right, top);
+        parent = top;
+        for (node = node->left; node != nullptr; node = node->left) {
+            Node* copy = createNode(static_cast<const Node*>(node)->data);
+            copy->red = node->red;
+            copy->parent = parent;
+            parent->left = copy;
+            if (node->right != nullptr)
+                copy->right = copySubtree(node->right, copy);
+            parent = copy;
+        }
+    } catch (...) {
+        eraseSubtree(top);
+        throw;
+    }
+    return top;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+void tree<Key, Value, KeyOfValue, Compare, Allocator>::eraseSubtree(TreeNodeBase* node) noexcept {
+    while (node != nullptr) {
+        eraseSubtree(node->right);
+        TreeNodeBase* left = node->left;
+        destroyNode(node);
+        node = left;
+    }
+}
+
+// без балансировки: узлы просто освобождаются снизу вверх
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+void tree<Key, Value, KeyOfValue, Compare, Allocator>::clear() noexcept {
+    eraseSubtree(header_.parent);
+    resetHeader();
+}
+
+// --------------------------------------- вставка -------------------------------------
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::InsertPos tree<Key, Value, KeyOfValue, Compare, Allocator>::uniquePos(const key_type& key) {
+    TreeNodeBase* node = header_.parent;
+    TreeNodeBase* parent = &header_;
+    bool left = true;
+    while (node != nullptr) {
+        parent = node;
+        left = comp_(key, keyOf(node));
+        node = left ? node->left : node->right;
+    }
+    // ключ не меньше parent: равный ему может быть только parent или его
+    // предшественник, остальные узлы уже отсеяны спуском
+    TreeNodeBase* candidate = parent;
+    if (left) {
+        if (candidate == header_.left)
+            return {parent, true, nullptr};
+        candidate = treeDecrement(candidate);
+    }
+    if (comp_(keyOf(candidate), key))
+        return {parent, left, nullptr};
+    return {nullptr, false, candidate};
+}
+
+// равные ключи встают после уже имеющихся — порядок вставки сохраняется
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::InsertPos tree<Key, Value, KeyOfValue, Compare, Allocator>::equalPos(const key_type& key) {
+    TreeNodeBase* node = header_.parent;
+    TreeNodeBase* parent = &header_;
+    bool left = true;
+    while (node != nullptr) {
+        parent = node;
+        left = comp_(key, keyOf(node));
+        node = left ? node->left : node->right;
+    }
+    return {parent, left, nullptr};
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::InsertPos tree<Key, Value, KeyOfValue, Compare, Allocator>::hintUniquePos(const_iterator hint, const key_type& key) {
+    TreeNodeBase* pos = const_cast<TreeNodeBase*>(hint.current);
+    if (pos == &header_) {
+        if (size_ > 0 && comp_(keyOf(header_.right), key))
+            return {header_.right, false, nullptr};
+        return uniquePos(key);
+    }
+    if (comp_(key, keyOf(pos))) {
+        if (pos == header_.left)
+            return {pos, true, nullptr};
+        TreeNodeBase* before = treeDecrement(pos);
+        if (comp_(keyOf(before), key)) {
+            // между соседями всегда есть свободное место: либо справа
+            // у before, либо слева у pos
+            if (before->right == nullptr)
+                return {before, false, nullptr};
+            return {pos, true, nullptr};
+        }
+        return uniquePos(key);
+    }
+    if (comp_(keyOf(pos), key)) {
+        if (pos == header_.right)
+            return {pos, false, nullptr};
+        TreeNodeBase* after = treeIncrement(pos);
+        if (comp_(key, keyOf(after))) {
+            if (pos->right == nullptr)
+                return {pos, false, nullptr};
+            return {after, true, nullptr};
+        }
+        return uniquePos(key);
+    }
+    return {nullptr, false, pos};
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::InsertPos tree<Key, Value, KeyOfValue, Compare, Allocator>::hintEqualPos(const_iterator hint, const key_type& key) {
+    TreeNodeBase* pos = const_cast<TreeNodeBase*>(hint.current);
+    if (pos == &header_) {
+        if (size_ > 0 && !comp_(key, keyOf(header_.right)))
+            return {header_.right, false, nullptr};
+        return equalPos(key);
+    }
+    if (!comp_(keyOf(pos), key)) {
+        // key <= pos: встаём прямо перед pos, если не меньше предшественника
+        if (pos == header_.left)
+            return {pos, true, nullptr};
+        TreeNodeBase* before = treeDecrement(pos);
+        if (!comp_(key, keyOf(before))) {
+            if (before->right == nullptr)
+                return {before, false, nullptr};
+            return {pos, true, nullptr};
+        }
+        return equalPos(key);
+    }
+    if (pos == header_.right)
+        return {pos, false, nullptr};
+    TreeNodeBase* after = treeIncrement(pos);
+    if (!comp_(keyOf(after), key)) {
+        if (pos->right == nullptr)
+            return {pos, false, nullptr};
+        return {after, true, nullptr};
+    }
+    return equalPos(key);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator tree<Key, Value, KeyOfValue, Compare, Allocator>::link(const InsertPos& pos, TreeNodeBase* node) {
+    treeInsertAndRebalance(pos.left, node, pos.parent, header_);
+    ++size_;
+    return iterator(node);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+template <typename V>
+std::pair<typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator, bool> tree<Key, Value, KeyOfValue, Compare, Allocator>::insertUnique(V&& value) {
+    InsertPos pos = uniquePos(KeyOfValue()(value));
+    if (pos.parent == nullptr)
+        return {iterator(pos.existing), false};
+    return {link(pos, createNode(std::forward<V>(value))), true};
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+template <typename V>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator tree<Key, Value, KeyOfValue, Compare, Allocator>::insertEqual(V&& value) {
+    InsertPos pos = equalPos(KeyOfValue()(value));
+    return link(pos, createNode(std::forward<V>(value)));
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+template <typename... Args>
+std::pair<typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator, bool> tree<Key, Value, KeyOfValue, Compare, Allocator>::emplaceUnique(Args&&... args) {
+    Node* node = createNode(std::forward<Args>(args)...);
+    InsertPos pos;
+    try {
+        pos = uniquePos(keyOf(node));
+    } catch (...) {
+        destroyNode(node);
+        throw;
+    }
+    if (pos.parent == nullptr) {
+        destroyNode(node);
+        return {iterator(pos.existing), false};
+    }
+    return {link(pos, node), true};
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+template <typename... Args>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator tree<Key, Value, KeyOfValue, Compare, Allocator>::emplaceEqual(Args&&... args) {
+    Node* node = createNode(std::forward<Args>(args)...);
+    InsertPos pos;
+    try {
+        pos = equalPos(keyOf(node));
+    } catch (...) {
+        destroyNode(node);
+        throw;
+    }
+    return link(pos, node);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+template <typename... Args>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator tree<Key, Value, KeyOfValue, Compare, Allocator>::emplaceHintUnique(const_iterator hint, Args&&... args) {
+    Node* node = createNode(std::forward<Args>(args)...);
+    InsertPos pos;
+    try {
+        pos = hintUniquePos(hint, keyOf(node));
+    } catch (...) {
+        destroyNode(node);
+        throw;
+    }
+    if (pos.parent == nullptr) {
+        destroyNode(node);
+        return iterator(pos.existing);
+    }
+    return link(pos, node);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+template <typename... Args>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator tree<Key, Value, KeyOfValue, Compare, Allocator>::emplaceHintEqual(const_iterator hint, Args&&... args) {
+    Node* node = createNode(std::forward<Args>(args)...);
+    InsertPos pos;
+    try {
+        pos = hintEqualPos(hint, keyOf(node));
+    } catch (...) {
+        destroyNode(node);
+        throw;
+    }
+    return link(pos, node);
+}
+
+// --------------------------------------- удаление -------------------------------------
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+TreeNodeBase* tree<Key, Value, KeyOfValue, Compare, Allocator>::extract(TreeNodeBase* node) {
+    TreeNodeBase* removed = treeRebalanceForErase(node, header_);
+    --size_;
+    return removed;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator tree<Key, Value, KeyOfValue, Compare, Allocator>::erase(const_iterator pos) {
+    if (pos == end())
+        throw std::out_of_range("Cannot erase end()");
+    TreeNodeBase* node = const_cast<TreeNodeBase*>(pos.current);
+    TreeNodeBase* next = treeIncrement(node);
+    destroyNode(extract(node));
+    return iterator(next);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator tree<Key, Value, KeyOfValue, Compare, Allocator>::erase(const_iterator first, const_iterator last) {
+    if (first == begin() && last == end()) {
+        clear();
+        return end();
+    }
+    while (first != last)
+        first = erase(first);
+    return iterator(const_cast<TreeNodeBase*>(last.current));
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::size_type tree<Key, Value, KeyOfValue, Compare, Allocator>::erase(const key_type& key) {
+    std::pair<iterator, iterator> range = equal_range(key);
+    size_type before = size_;
+    erase(range.first, range.second);
+    return before - size_;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::size_type tree<Key, Value, KeyOfValue, Compare, Allocator>::eraseUnique(const key_type& key) {
+    TreeNodeBase* node = lowerBound(key);
+    if (node == &header_ || comp_(key, keyOf(node)))
+        return 0;
+    destroyNode(extract(node));
+    return 1;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+void tree<Key, Value, KeyOfValue, Compare, Allocator>::swap(tree& other) noexcept {
+    if (this == &other) return;
+    std::swap(header_, other.header_);
+    std::swap(size_, other.size_);
+    std::swap(comp_, other.comp_);
+    // после обмена связи стража указывают на чужой header_
+    if (header_.parent == nullptr)
+        header_.left = header_.right = &header_;
+    else
+        header_.parent->parent = &header_;
+    if (other.header_.parent == nullptr)
+        other.header_.left = other.header_.right = &other.header_;
+    else
+        other.header_.parent->parent = &other.header_;
+    if (node_traits::propagate_on_container_swap::value)
+        std::swap(alloc_, other.alloc_);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+void tree<Key, Value, KeyOfValue, Compare, Allocator>::mergeUnique(tree& other) {
+    if (this == &other) return;
+    const bool sameAlloc = alloc_ == other.alloc_;
+    for (TreeNodeBase* node = other.header_.left; node != &other.header_;) {
+        TreeNodeBase* next = treeIncrement(node);
+        InsertPos pos = uniquePos(keyOf(node));
+        if (pos.parent != nullptr) {
+            if (sameAlloc) {
+                link(pos, other.extract(node));
+            } else {
+                link(pos, createNode(std::move(static_cast<Node*>(node)->data)));
+                other.destroyNode(other.extract(node));
+            }
+        }
+        node = next;
+    }
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+void tree<Key, Value, KeyOfValue, Compare, Allocator>::mergeEqual(tree& other) {
+    if (this == &other) return;
+    const bool sameAlloc = alloc_ == other.alloc_;
+    for (TreeNodeBase* node = other.header_.left; node != &other.header_;) {
+        TreeNodeBase* next = treeIncrement(node);
+        InsertPos pos = equalPos(keyOf(node));
+        if (sameAlloc) {
+            link(pos, other.extract(node));
+        } else {
+            link(pos, createNode(std::move(static_cast<Node*>(node)->data)));
+            other.destroyNode(other.extract(node));
+        }
+        node = next;
+    }
+}
+
+// --------------------------------------- поиск -------------------------------------
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+TreeNodeBase* tree<Key, Value, KeyOfValue, Compare, Allocator>::lowerBound(const key_type& key) const {
+    TreeNodeBase* node = header_.parent;
+    TreeNodeBase* result = header();
+    while (node != nullptr) {
+        if (!comp_(keyOf(node), key)) {
+            result = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    return result;
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+TreeNodeBase* tree<Key, Value, KeyOfValue, Compare, Allocator>::upperBound(const key_type& key) const {
+    TreeNodeBase* node = header_.parent;
+    TreeNodeBase* result = header();
+    while (node != nullptr) {
+        if (comp_(key, keyOf(node))) {
+            result = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    return result;
+}
+
+// одно сравнение на уровень, равенство проверяется один раз в конце
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator tree<Key, Value, KeyOfValue, Compare, Allocator>::find(const key_type& key) {
+    TreeNodeBase* node = lowerBound(key);
+    if (node == &header_ || comp_(key, keyOf(node)))
+        return end();
+    return iterator(node);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::const_iterator tree<Key, Value, KeyOfValue, Compare, Allocator>::find(const key_type& key) const {
+    TreeNodeBase* node = lowerBound(key);
+    if (node == &header_ || comp_(key, keyOf(node)))
+        return end();
+    return const_iterator(node);
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+std::pair<typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator, typename tree<Key, Value, KeyOfValue, Compare, Allocator>::iterator>
+tree<Key, Value, KeyOfValue, Compare, Allocator>::equal_range(const key_type& key) {
+    return {iterator(lowerBound(key)), iterator(upperBound(key))};
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+std::pair<typename tree<Key, Value, KeyOfValue, Compare, Allocator>::const_iterator, typename tree<Key, Value, KeyOfValue, Compare, Allocator>::const_iterator>
+tree<Key, Value, KeyOfValue, Compare, Allocator>::equal_range(const key_type& key) const {
+    return {const_iterator(lowerBound(key)), const_iterator(upperBound(key))};
+}
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+typename tree<Key, Value, KeyOfValue, Compare, Allocator>::size_type tree<Key, Value, KeyOfValue, Compare, Allocator>::count(const key_type& key) const {
+    size_type result = 0;
+    for (const TreeNodeBase* node = lowerBound(key), *last = upperBound(key); node != last; node = treeIncrement(node))
+        ++result;
+    return result;
+}
+
+// --------------------------------------- проверка -------------------------------------
+
+template <typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+bool tree<Key, Value, KeyOfValue, Compare, Allocator>::verify() const {
+    const TreeNodeBase* root = header_.parent;
+    if (root == nullptr)
+        return size_ == 0 && header_.left == &header_ && header_.right == &header_;
+    if (root->red || root->parent != &header_)
+        return false;
+    if (header_.left != treeMinimum(const_cast<TreeNodeBase*>(root)) ||
+        header_.right != treeMaximum(const_cast<TreeNodeBase*>(root)))
+        return false;
+
+    // число чёрных узлов на пути от корня до самого левого листа —
+    // эталон для всех остальных путей
+    size_type blackHeight = 0;
+    for (const TreeNodeBase* node = root; node != nullptr; node = node->left)
+        blackHeight += !node->red;
+
+    size_type nodes = 0;
+    for (const TreeNodeBase* node = header_.left; node != &header_; node = treeIncrement(node)) {
+        ++nodes;
+        const TreeNodeBase* left = node->left;
+        const TreeNodeBase* right = node->right;
+        if (left != nullptr && (left->parent != node || comp_(keyOf(node), keyOf(left))))
+            return false;
+        if (right != nullptr && (right->parent != node || comp_(keyOf(right), keyOf(node))))
+            return false;
+        if (node->red && ((left != nullptr && left->red) || (right != nullptr && right->red)))
+            return false;
+        if (left == nullptr || right == nullptr) {
+            size_type black = 0;
+            for (const TreeNodeBase* up = node; up != &header_; up = up->parent)
+                black += !up->red;
+            if (black != blackHeight)
+                return false;
+        }
+        const TreeNodeBase* next = treeIncrement(node);
+        if (next != &header_ && comp_(keyOf(next), keyOf(node)))
+            return false;
+    }
+    return nodes == size_;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_TREE_H
@@ -0,0 +1,200 @@
+#ifndef S21_CONTAINERS_UNORDERED_MAP_H
+#define S21_CONTAINERS_UNORDERED_MAP_H
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "hash_table.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Хеш-словарь с открытой адресацией. Пары лежат прямо в массиве слотов
+// таблицы, поэтому любая вставка, вызвавшая рост, делает недействительными
+// все итераторы и ссылки; удаление не трогает остальные элементы
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Allocator;
+
+private:
+    struct KeyOfValue {
+        const key_type& operator()(const value_type& value) const { return value.first; }
+    };
+    using table_type = hash_table<key_type, value_type, KeyOfValue, Hash, KeyEqual, Allocator>;
+
+    template <typename K>
+    using transparent_key =
+        typename std::enable_if<HashIsTransparent<Hash>::value && HashIsTransparent<KeyEqual>::value, K>::type;
+
+public:
+    using iterator = typename table_type::iterator;
+    using const_iterator = typename table_type::const_iterator;
+    using size_type = size_t;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    unordered_map() = default;
+    explicit unordered_map(size_type bucketCount, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                           const allocator_type& alloc = allocator_type())
+        : table_(bucketCount, hash, equal, alloc) {}
+    unordered_map(std::initializer_list<value_type> const &items);
+    template <typename InputIt>
+    unordered_map(InputIt first, InputIt last);
+    unordered_map(const unordered_map &m) = default;
+    unordered_map(unordered_map &&m) noexcept = default;
+    ~unordered_map() = default;
+
+    unordered_map& operator=(const unordered_map &m) = default;
+    unordered_map& operator=(unordered_map &&m) = default;
+
+    // -------------------  доступ к элементам -------------------
+    T& at(const Key& key);
+    const T& at(const Key& key) const;
+    T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+    // ------------------- итераторы -------------------
+    iterator begin() noexcept { return table_.begin(); }
+    iterator end() noexcept { return table_.end(); }
+    const_iterator begin() const noexcept { return table_.begin(); }
+    const_iterator end() const noexcept { return table_.end(); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const noexcept { return table_.empty(); }
+    size_type size() const noexcept { return table_.size(); }
+    size_type max_size() const noexcept { return table_.max_size(); }
+    allocator_type get_allocator() const { return table_.get_allocator(); }
+
+    // ------------------- хеширование -------------------
+    size_type bucket_count() const noexcept { return table_.bucket_count(); }
+    float load_factor() const noexcept { return table_.load_factor(); }
+    float max_load_factor() const noexcept { return table_.max_load_factor(); }
+    void max_load_factor(float load) { table_.max_load_factor(load); }
+    void reserve(size_type count) { table_.reserve(count); } // no rehash until size() exceeds count
+    void rehash(size_type count) { table_.rehash(count); }
+    hasher hash_function() const { return table_.hash_function(); }
+    key_equal key_eq() const { return table_.key_eq(); }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept { table_.clear(); }
+    std::pair<iterator, bool> insert(const value_type& value) { return table_.tryEmplace(value.first, value); }
+    std::pair<iterator, bool> insert(value_type&& value) { return table_.tryEmplace(value.first, std::move(value)); }
+    std::pair<iterator, bool> insert(const Key& key, const T& obj) { return table_.tryEmplace(key, key, obj); }
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last);
+    std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) { return table_.emplace(std::forward<Args>(args)...); }
+    // значение строится, только если ключа ещё нет
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+    iterator erase(const_iterator pos) { return table_.erase(pos); }
+    iterator erase(iterator pos) { return table_.erase(pos); }
+    size_type erase(const Key& key) { return table_.erase(key); }
+    void swap(unordered_map& other) noexcept { table_.swap(other.table_); }
+    template <typename... Args>
+    vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+    // ------------------- поиск -------------------
+    iterator find(const Key& key) { return table_.find(key); }
+    const_iterator find(const Key& key) const { return table_.find(key); }
+    bool contains(const Key& key) const { return table_.contains(key); }
+    size_type count(const Key& key) const { return table_.contains(key) ? 1 : 0; }
+    // поиск без построения Key, если Hash и KeyEqual прозрачные
+    template <typename K, typename = transparent_key<K>>
+    iterator find(const K& key) { return table_.find(key); }
+    template <typename K, typename = transparent_key<K>>
+    const_iterator find(const K& key) const { return table_.find(key); }
+    template <typename K, typename = transparent_key<K>>
+    bool contains(const K& key) const { return table_.contains(key); }
+    template <typename K, typename = transparent_key<K>>
+    size_type count(const K& key) const { return table_.contains(key) ? 1 : 0; }
+
+private:
+    table_type table_;
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(std::initializer_list<value_type> const &items)
+    : table_(items.size()) {
+    for (const value_type& item : items)
+        insert(item);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename InputIt>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(InputIt first, InputIt last) {
+    insert(first, last);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename InputIt>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(InputIt first, InputIt last) {
+    // для прямых итераторов размер известен заранее — таблица растёт один раз
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value)
+        table_.reserve(size() + static_cast<size_type>(std::distance(first, last)));
+    for (; first != last; ++first)
+        insert(*first);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+T& unordered_map<Key, T, Hash, KeyEqual, Allocator>::at(const Key& key) {
+    iterator it = table_.find(key);
+    if (it == table_.end())
+        throw std::out_of_range("Key not found");
+    return it->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+const T& unordered_map<Key, T, Hash, KeyEqual, Allocator>::at(const Key& key) const {
+    const_iterator it = table_.find(key);
+    if (it == table_.end())
+        throw std::out_of_range("Key not found");
+    return it->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert_or_assign(const Key& key, const T& obj) {
+    std::pair<iterator, bool> result = table_.tryEmplace(key, key, obj);
+    if (!result.second)
+        result.first->second = obj;
+    return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::try_emplace(const Key& key, Args&&... args) {
+    return table_.tryEmplace(key, std::piecewise_construct, std::forward_as_tuple(key),
+                             std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename... Args>
+vector<std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert_many(Args&&... args) {
+    // рост таблицы переносит пары, поэтому места под все ключи берутся заранее,
+    // иначе итераторы из первых вставок устарели бы к концу
+    table_.reserve(size() + sizeof...(Args));
+    vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    (result.push_back(table_.emplace(std::forward<Args>(args))), ...);
+    return result;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_UNORDERED_MAP_H
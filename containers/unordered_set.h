@@ -0,0 +1,145 @@
+#ifndef S21_CONTAINERS_UNORDERED_SET_H
+#define S21_CONTAINERS_UNORDERED_SET_H
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+#include "hash_table.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Хеш-множество с открытой адресацией на том же движке, что unordered_map.
+// Ключи менять нельзя, поэтому iterator — константный итератор таблицы
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Key>>
+class unordered_set {
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Allocator;
+
+private:
+    struct KeyOfValue {
+        const key_type& operator()(const value_type& value) const { return value; }
+    };
+    using table_type = hash_table<key_type, value_type, KeyOfValue, Hash, KeyEqual, Allocator>;
+
+    template <typename K>
+    using transparent_key =
+        typename std::enable_if<HashIsTransparent<Hash>::value && HashIsTransparent<KeyEqual>::value, K>::type;
+
+public:
+    using iterator = typename table_type::const_iterator;
+    using const_iterator = typename table_type::const_iterator;
+    using size_type = size_t;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    unordered_set() = default;
+    explicit unordered_set(size_type bucketCount, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                           const allocator_type& alloc = allocator_type())
+        : table_(bucketCount, hash, equal, alloc) {}
+    unordered_set(std::initializer_list<value_type> const &items);
+    template <typename InputIt>
+    unordered_set(InputIt first, InputIt last);
+    unordered_set(const unordered_set &s) = default;
+    unordered_set(unordered_set &&s) noexcept = default;
+    ~unordered_set() = default;
+
+    unordered_set& operator=(const unordered_set &s) = default;
+    unordered_set& operator=(unordered_set &&s) = default;
+
+    // ------------------- итераторы -------------------
+    iterator begin() const noexcept { return table_.begin(); }
+    iterator end() const noexcept { return table_.end(); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const noexcept { return table_.empty(); }
+    size_type size() const noexcept { return table_.size(); }
+    size_type max_size() const noexcept { return table_.max_size(); }
+    allocator_type get_allocator() const { return table_.get_allocator(); }
+
+    // ------------------- хеширование -------------------
+    size_type bucket_count() const noexcept { return table_.bucket_count(); }
+    float load_factor() const noexcept { return table_.load_factor(); }
+    float max_load_factor() const noexcept { return table_.max_load_factor(); }
+    void max_load_factor(float load) { table_.max_load_factor(load); }
+    void reserve(size_type count) { table_.reserve(count); } // no rehash until size() exceeds count
+    void rehash(size_type count) { table_.rehash(count); }
+    hasher hash_function() const { return table_.hash_function(); }
+    key_equal key_eq() const { return table_.key_eq(); }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept { table_.clear(); }
+    std::pair<iterator, bool> insert(const value_type& value) { return table_.tryEmplace(value, value); }
+    std::pair<iterator, bool> insert(value_type&& value) { return table_.tryEmplace(value, std::move(value)); }
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last);
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) { return table_.emplace(std::forward<Args>(args)...); }
+    iterator erase(const_iterator pos) { return table_.erase(pos); }
+    size_type erase(const Key& key) { return table_.erase(key); }
+    void swap(unordered_set& other) noexcept { table_.swap(other.table_); }
+    template <typename... Args>
+    vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+    // ------------------- поиск -------------------
+    iterator find(const Key& key) const { return table_.find(key); }
+    bool contains(const Key& key) const { return table_.contains(key); }
+    size_type count(const Key& key) const { return table_.contains(key) ? 1 : 0; }
+    // поиск без построения Key, если Hash и KeyEqual прозрачные
+    template <typename K, typename = transparent_key<K>>
+    iterator find(const K& key) const { return table_.find(key); }
+    template <typename K, typename = transparent_key<K>>
+    bool contains(const K& key) const { return table_.contains(key); }
+    template <typename K, typename = transparent_key<K>>
+    size_type count(const K& key) const { return table_.contains(key) ? 1 : 0; }
+
+private:
+    table_type table_;
+};
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+unordered_set<Key, Hash, KeyEqual, Allocator>::unordered_set(std::initializer_list<value_type> const &items)
+    : table_(items.size()) {
+    for (const value_type& item : items)
+        insert(item);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+template <typename InputIt>
+unordered_set<Key, Hash, KeyEqual, Allocator>::unordered_set(InputIt first, InputIt last) {
+    insert(first, last);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+template <typename InputIt>
+void unordered_set<Key, Hash, KeyEqual, Allocator>::insert(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value)
+        table_.reserve(size() + static_cast<size_type>(std::distance(first, last)));
+    for (; first != last; ++first)
+        insert(*first);
+}
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+template <typename... Args>
+vector<std::pair<typename unordered_set<Key, Hash, KeyEqual, Allocator>::iterator, bool>>
+unordered_set<Key, Hash, KeyEqual, Allocator>::insert_many(Args&&... args) {
+    // места под все ключи берутся заранее, чтобы рост не сдвинул уже вставленные
+    table_.reserve(size() + sizeof...(Args));
+    vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(Args));
+    (result.push_back(table_.emplace(std::forward<Args>(args))), ...);
+    return result;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_UNORDERED_SET_H
@@ -0,0 +1,652 @@
+#ifndef S21_CONTAINERS_UNROLLED_LIST_H
+#define S21_CONTAINERS_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "cache_line.h"
+#include "vector.h"
+
+namespace s21 {
+
+// по умолчанию блок занимает около четырёх строк кэша, но не меньше 4 элементов
+template <typename T>
+constexpr std::size_t kUnrolledDefaultCount =
+    (256 - 3 * sizeof(void*)) / sizeof(T) > 4 ? (256 - 3 * sizeof(void*)) / sizeof(T) : 4;
+
+// Развёрнутый список: двусвязный список блоков, в каждом до N элементов
+// подряд. Накладные расходы — два указателя и счётчик на блок, а не на
+// элемент, и обход идёт по непрерывной памяти внутри блока.
+// Элементы блока всегда лежат в [0, count). Полный блок при вставке
+// делится пополам; блок, опустевший на четверть и меньше, сливается
+// со следующим, если они помещаются в один.
+//
+// Устойчивость итераторов и ссылок (строже, чем у s21::list):
+//  - insert/emplace и erase портят итераторы на элементы затронутого блока
+//    (и соседнего, если блоки делились или сливались); остальные живы;
+//  - push_back/emplace_back не трогают уже вставленные элементы;
+//  - splice сохраняет итераторы на элементы other, кроме блока в pos,
+//    который может быть разрезан;
+//  - sort, unique, reverse, merge переставляют значения — итераторы на
+//    элементы после них указывают на другие значения;
+//  - swap и перемещение сохраняют итераторы, кроме end().
+template <typename T, std::size_t N = kUnrolledDefaultCount<T>, typename Allocator = std::allocator<T>>
+class unrolled_list {
+    static_assert(N >= 2, "unrolled_list needs at least two elements per block");
+
+    template <bool Const>
+    class UnrolledIterator;
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = UnrolledIterator<false>;
+    using const_iterator = UnrolledIterator<true>;
+    using size_type = size_t;
+    using allocator_type = Allocator;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    unrolled_list() = default;
+    explicit unrolled_list(const allocator_type& alloc) : alloc_(alloc) {}
+    explicit unrolled_list(size_type n);
+    unrolled_list(std::initializer_list<value_type> const &items);
+    unrolled_list(const unrolled_list &l);
+    unrolled_list(unrolled_list &&l) noexcept;
+    ~unrolled_list() { clear(); }
+
+    unrolled_list& operator=(const unrolled_list &l);
+    unrolled_list& operator=(unrolled_list &&l) noexcept(std::allocator_traits<Allocator>::is_always_equal::value ||
+                                                         std::allocator_traits<Allocator>::
+                                                             propagate_on_container_move_assignment::value);
+
+    // -------------------  доступ к элементам -------------------
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+    reference back() { return *(--end()); }
+    const_reference back() const { return *(--end()); }
+    reference operator[](size_type index); // skips whole blocks from the nearer end
+
+    // ------------------- итераторы -------------------
+    iterator begin() noexcept { return iterator(end_.next, 0); }
+    iterator end() noexcept { return iterator(&end_, 0); }
+    const_iterator begin() const noexcept { return const_iterator(end_.next, 0); }
+    const_iterator end() const noexcept { return const_iterator(&end_, 0); }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type max_size() const noexcept { return std::numeric_limits<size_type>::max(); }
+    allocator_type get_allocator() const { return allocator_type(alloc_); }
+    // занятая блоками память — для оценки накладных расходов
+    size_type memory_usage() const noexcept { return blocks_ * sizeof(Block); }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept;
+    void push_back(const_reference value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+    void push_front(const_reference value) { emplace_front(value); }
+    void push_front(value_type&& value) { emplace_front(std::move(value)); }
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    template <typename... Args>
+    reference emplace_front(Args&&... args) { return *emplace(begin(), std::forward<Args>(args)...); }
+    void pop_back();
+    void pop_front();
+    iterator insert(const_iterator pos, const_reference value) { return emplace(pos, value); }
+    iterator insert(const_iterator pos, value_type&& value) { return emplace(pos, std::move(value)); }
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    void swap(unrolled_list& other) noexcept;
+    void splice(const_iterator pos, unrolled_list& other);
+    void reverse() noexcept;
+    void unique();
+    void sort() { sort(std::less<value_type>()); }
+    template <typename Compare>
+    void sort(Compare comp);
+    void merge(unrolled_list& other) { merge(other, std::less<value_type>()); }
+    template <typename Compare>
+    void merge(unrolled_list& other, Compare comp);
+    template <typename... Args>
+    iterator insert_many(const_iterator pos, Args&&... args);
+    template <typename... Args>
+    void insert_many_back(Args&&... args) { (emplace_back(std::forward<Args>(args)), ...); }
+    template <typename... Args>
+    void insert_many_front(Args&&... args) { insert_many(begin(), std::forward<Args>(args)...); }
+
+private:
+    struct BlockBase {
+        BlockBase* next;
+        BlockBase* prev;
+    };
+
+    struct alignas(kCacheLineSize) Block : BlockBase {
+        size_type count;
+        alignas(T) unsigned char storage[N * sizeof(T)];
+
+        T* data() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+    using block_traits = std::allocator_traits<block_allocator>;
+    using value_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using value_traits = std::allocator_traits<value_allocator>;
+
+    static Block* blockOf(BlockBase* base) noexcept { return static_cast<Block*>(base); }
+    static BlockBase* mutableBlock(const BlockBase* base) noexcept { return const_cast<BlockBase*>(base); }
+
+    // новый пустой блок встаёт перед before
+    Block* createBlock(BlockBase* before);
+    void destroyBlock(Block* block) noexcept;
+    void destroyValue(T* value) noexcept;
+    template <typename V>
+    void constructValue(T* slot, V&& value);
+    // вставка готового значения в блок по индексу; блок не полон
+    T* insertIntoBlock(Block* block, size_type index, T&& value);
+    // полный блок делится пополам, возвращает новый (правую половину)
+    Block* splitBlock(Block* block, size_type keep);
+    void mergeWithNext(Block* block);
+    void stealBlocks(unrolled_list& other) noexcept;
+    void relinkSentinel() noexcept;
+
+    BlockBase end_{&end_, &end_};
+    size_type size_ = 0;
+    size_type blocks_ = 0;
+    block_allocator alloc_;
+};
+
+// итератор — блок и номер элемента в нём; end() — страж с номером 0
+template <typename T, std::size_t N, typename Allocator>
+template <bool Const>
+class unrolled_list<T, N, Allocator>::UnrolledIterator {
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<Const, const T*, T*>::type;
+    using reference = typename std::conditional<Const, const T&, T&>::type;
+    using block_pointer = typename std::conditional<Const, const BlockBase*, BlockBase*>::type;
+
+    UnrolledIterator() = default;
+    UnrolledIterator(block_pointer block, size_type index) : block_(block), index_(index) {}
+    // iterator -> const_iterator
+    template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+    UnrolledIterator(const UnrolledIterator<OtherConst>& other) : block_(other.block_), index_(other.index_) {}
+
+    reference operator*() const { return blockOf(mutableBlock(block_))->data()[index_]; }
+    pointer operator->() const { return &**this; }
+
+    UnrolledIterator& operator++() {
+        if (++index_ == blockOf(mutableBlock(block_))->count) {
+            block_ = block_->next;
+            index_ = 0;
+        }
+        return *this;
+    }
+    UnrolledIterator operator++(int) {
+        UnrolledIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    UnrolledIterator& operator--() {
+        if (index_ == 0) {
+            block_ = block_->prev;
+            index_ = blockOf(mutableBlock(block_))->count;
+        }
+        --index_;
+        return *this;
+    }
+    UnrolledIterator operator--(int) {
+        UnrolledIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const UnrolledIterator& other) const { return block_ == other.block_ && index_ == other.index_; }
+    bool operator!=(const UnrolledIterator& other) const { return !(*this == other); }
+
+private:
+    template <bool>
+    friend class UnrolledIterator;
+    friend class unrolled_list;
+
+    block_pointer block_ = nullptr;
+    size_type index_ = 0;
+};
+
+// ------------------------------------- конструкторы и присваивания -------------------------------------
+
+template <typename T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::unrolled_list(size_type n) {
+    try {
+        for (size_type i = 0; i < n; ++i)
+            emplace_back();
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::unrolled_list(std::initializer_list<value_type> const &items) {
+    try {
+        for (const value_type& item : items)
+            emplace_back(item);
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::unrolled_list(const unrolled_list &l)
+    : alloc_(block_traits::select_on_container_copy_construction(l.alloc_)) {
+    try {
+        for (const value_type& item : l)
+            emplace_back(item);
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::unrolled_list(unrolled_list &&l) noexcept : alloc_(l.alloc_) {
+    stealBlocks(l);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>& unrolled_list<T, N, Allocator>::operator=(const unrolled_list &l) {
+    if (this != &l) {
+        unrolled_list copy(l);
+        swap(copy);
+    }
+    return *this;
+}
+
+// как в list: блоки l можно забрать, только если их сможет освободить наш
+// аллокатор, иначе элементы переносятся по одному
+template <typename T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>& unrolled_list<T, N, Allocator>::operator=(unrolled_list &&l) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+    if (this == &l)
+        return *this;
+    clear();
+    if (block_traits::propagate_on_container_move_assignment::value)
+        alloc_ = l.alloc_;
+    else if (!block_traits::is_always_equal::value && !(alloc_ == l.alloc_)) {
+        for (auto it = l.begin(); it != l.end(); ++it)
+            push_back(std::move(*it));
+        l.clear();
+        return *this;
+    }
+    stealBlocks(l);
+    return *this;
+}
+
+// ------------------------------------- блоки -------------------------------------
+
+template <typename T, std::size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::Block* unrolled_list<T, N, Allocator>::createBlock(BlockBase* before) {
+    Block* block = block_traits::allocate(alloc_, 1);
+    block->count = 0;
+    block->next = before;
+    block->prev = before->prev;
+    before->prev->next = block;
+    before->prev = block;
+    ++blocks_;
+    return block;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::destroyBlock(Block* block) noexcept {
+    T* data = block->data();
+    for (size_type i = 0; i < block->count; ++i)
+        destroyValue(data + i);
+    block->prev->next = block->next;
+    block->next->prev = block->prev;
+    block_traits::deallocate(alloc_, block, 1);
+    --blocks_;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::destroyValue(T* value) noexcept {
+    value_allocator valueAlloc(alloc_);
+    value_traits::destroy(valueAlloc, value);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <typename V>
+void unrolled_list<T, N, Allocator>::constructValue(T* slot, V&& value) {
+    value_allocator valueAlloc(alloc_);
+    value_traits::construct(valueAlloc, slot, std::forward<V>(value));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T* unrolled_list<T, N, Allocator>::insertIntoBlock(Block* block, size_type index, T&& value) {
+    T* data = block->data();
+    size_type count = block->count;
+    if (index == count) {
+        constructValue(data + count, std::move(value));
+    } else {
+        constructValue(data + count, std::move(data[count - 1]));
+        std::move_backward(data + index, data + count - 1, data + count);
+        data[index] = std::move(value);
+    }
+    ++block->count;
+    ++size_;
+    return data + index;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::Block* unrolled_list<T, N, Allocator>::splitBlock(Block* block, size_type keep) {
+    Block* right = createBlock(block->next);
+    T* from = block->data();
+    T* to = right->data();
+    for (size_type i = keep; i < block->count; ++i) {
+        constructValue(to + right->count, std::move(from[i]));
+        ++right->count;
+    }
+    for (size_type i = keep; i < block->count; ++i)
+        destroyValue(from + i);
+    block->count = keep;
+    return right;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::mergeWithNext(Block* block) {
+    Block* next = blockOf(block->next);
+    T* to = block->data();
+    T* from = next->data();
+    for (size_type i = 0; i < next->count; ++i) {
+        constructValue(to + block->count, std::move(from[i]));
+        ++block->count;
+    }
+    destroyBlock(next);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::relinkSentinel() noexcept {
+    if (size_ == 0) {
+        end_.next = end_.prev = &end_;
+    } else {
+        end_.next->prev = &end_;
+        end_.prev->next = &end_;
+    }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::stealBlocks(unrolled_list& other) noexcept {
+    end_ = other.end_;
+    size_ = other.size_;
+    blocks_ = other.blocks_;
+    relinkSentinel();
+    other.end_.next = other.end_.prev = &other.end_;
+    other.size_ = other.blocks_ = 0;
+}
+
+// ------------------------------------- доступ -------------------------------------
+
+template <typename T, std::size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::reference unrolled_list<T, N, Allocator>::operator[](size_type index) {
+    if (index >= size_)
+        throw std::out_of_range("Index out of range");
+    if (index < size_ / 2) {
+        BlockBase* block = end_.next;
+        while (index >= blockOf(block)->count) {
+            index -= blockOf(block)->count;
+            block = block->next;
+        }
+        return blockOf(block)->data()[index];
+    }
+    size_type fromBack = size_ - 1 - index;
+    BlockBase* block = end_.prev;
+    while (fromBack >= blockOf(block)->count) {
+        fromBack -= blockOf(block)->count;
+        block = block->prev;
+    }
+    return blockOf(block)->data()[blockOf(block)->count - 1 - fromBack];
+}
+
+// ------------------------------------- модификаторы -------------------------------------
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::clear() noexcept {
+    while (end_.next != &end_)
+        destroyBlock(blockOf(end_.next));
+    size_ = 0;
+}
+
+// быстрый путь: элемент строится прямо в свободном слоте хвостового блока
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+typename unrolled_list<T, N, Allocator>::reference unrolled_list<T, N, Allocator>::emplace_back(Args&&... args) {
+    Block* tail = blockOf(end_.prev);
+    bool fresh = end_.prev == &end_ || tail->count == N;
+    if (fresh)
+        tail = createBlock(&end_);
+    T* slot = tail->data() + tail->count;
+    try {
+        value_allocator valueAlloc(alloc_);
+        value_traits::construct(valueAlloc, slot, std::forward<Args>(args)...);
+    } catch (...) {
+        if (fresh)
+            destroyBlock(tail);
+        throw;
+    }
+    ++tail->count;
+    ++size_;
+    return *slot;
+}
+
+// значение строится заранее: дальше только переносы внутри блоков
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+typename unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::emplace(const_iterator pos, Args&&... args) {
+    T value(std::forward<Args>(args)...);
+    BlockBase* base = mutableBlock(pos.block_);
+    size_type index = pos.index_;
+    // вставка перед началом блока (или в конец) — сначала пробуем предыдущий блок
+    if (index == 0 && base->prev != &end_ && blockOf(base->prev)->count < N) {
+        Block* prev = blockOf(base->prev);
+        size_type at = prev->count;
+        insertIntoBlock(prev, at, std::move(value));
+        return iterator(prev, at);
+    }
+    if (base == &end_ || (index == 0 && blockOf(base)->count == N)) {
+        Block* block = createBlock(base);
+        insertIntoBlock(block, 0, std::move(value));
+        return iterator(block, 0);
+    }
+    Block* block = blockOf(base);
+    if (block->count == N) {
+        Block* right = splitBlock(block, N / 2);
+        if (index > N / 2) {
+            block = right;
+            index -= N / 2;
+        }
+    }
+    insertIntoBlock(block, index, std::move(value));
+    return iterator(block, index);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::erase(const_iterator pos) {
+    if (pos.block_ == &end_)
+        throw std::out_of_range("Iterator out of range");
+    iterator next = erase(pos, std::next(pos));
+    return next;
+}
+
+// диапазон удаляется поблочно: в каждом блоке хвост сдвигается один раз
+template <typename T, std::size_t N, typename Allocator>
+typename unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::erase(const_iterator first, const_iterator last) {
+    BlockBase* lastBlock = mutableBlock(last.block_);
+    size_type lastIndex = last.index_;
+    BlockBase* base = mutableBlock(first.block_);
+    size_type from = first.index_;
+    while (base != lastBlock || from != lastIndex) {
+        Block* block = blockOf(base);
+        size_type to = base == lastBlock ? lastIndex : block->count;
+        size_type removed = to - from;
+        T* data = block->data();
+        std::move(data + to, data + block->count, data + from);
+        for (size_type i = block->count - removed; i < block->count; ++i)
+            destroyValue(data + i);
+        block->count -= removed;
+        size_ -= removed;
+        if (base == lastBlock) {
+            lastIndex = from;
+            break;
+        }
+        BlockBase* next = base->next;
+        if (block->count == 0)
+            destroyBlock(block);
+        base = next;
+        from = 0;
+    }
+    // блок, где остановились, мог опустеть или стать слишком маленьким
+    if (lastBlock != &end_) {
+        Block* block = blockOf(lastBlock);
+        if (block->count == 0) {
+            BlockBase* next = block->next;
+            destroyBlock(block);
+            return iterator(next, 0);
+        }
+        if (block->count <= N / 4 && block->next != &end_ && block->count + blockOf(block->next)->count <= N)
+            mergeWithNext(block);
+        if (lastIndex == block->count)
+            return iterator(block->next, 0);
+    }
+    return iterator(lastBlock, lastIndex);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::pop_back() {
+    if (size_ == 0)
+        throw std::out_of_range("List is empty");
+    Block* tail = blockOf(end_.prev);
+    destroyValue(tail->data() + tail->count - 1);
+    --size_;
+    if (--tail->count == 0)
+        destroyBlock(tail);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::pop_front() {
+    if (size_ == 0)
+        throw std::out_of_range("List is empty");
+    erase(begin());
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::swap(unrolled_list& other) noexcept {
+    std::swap(end_, other.end_);
+    std::swap(size_, other.size_);
+    std::swap(blocks_, other.blocks_);
+    relinkSentinel();
+    other.relinkSentinel();
+    if (block_traits::propagate_on_container_swap::value)
+        std::swap(alloc_, other.alloc_);
+}
+
+// блоки other перевешиваются целиком; блок в pos режется, чтобы вставка
+// пришлась на границу блоков
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::splice(const_iterator pos, unrolled_list& other) {
+    if (this == &other || other.size_ == 0)
+        return;
+    BlockBase* before = mutableBlock(pos.block_);
+    if (pos.index_ != 0)
+        before = splitBlock(blockOf(before), pos.index_);
+    BlockBase* first = other.end_.next;
+    BlockBase* last = other.end_.prev;
+    first->prev = before->prev;
+    before->prev->next = first;
+    last->next = before;
+    before->prev = last;
+    size_ += other.size_;
+    blocks_ += other.blocks_;
+    other.end_.next = other.end_.prev = &other.end_;
+    other.size_ = other.blocks_ = 0;
+}
+
+// порядок блоков разворачивается так же, как узлы s21::list, а элементы
+// внутри каждого блока — std::reverse
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::reverse() noexcept {
+    BlockBase* current = &end_;
+    do {
+        std::swap(current->next, current->prev);
+        current = current->prev;
+        if (current != &end_)
+            std::reverse(blockOf(current)->data(), blockOf(current)->data() + blockOf(current)->count);
+    } while (current != &end_);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::unique() {
+    if (size_ <= 1)
+        return;
+    erase(std::unique(begin(), end()), end());
+}
+
+// узлов-одиночек нет, поэтому сортируются значения: переносятся в массив,
+// сортируются устойчиво и переносятся обратно на те же места
+template <typename T, std::size_t N, typename Allocator>
+template <typename Compare>
+void unrolled_list<T, N, Allocator>::sort(Compare comp) {
+    if (size_ <= 1)
+        return;
+    vector<T> values;
+    values.reserve(size_);
+    for (T& value : *this)
+        values.push_back(std::move(value));
+    std::stable_sort(values.begin(), values.end(), comp);
+    T* source = values.begin();
+    for (T& value : *this)
+        value = std::move(*source++);
+}
+
+// блоки other подшиваются в конец, затем две отсортированные половины
+// сливаются на месте; при равенстве элементы this идут раньше
+template <typename T, std::size_t N, typename Allocator>
+template <typename Compare>
+void unrolled_list<T, N, Allocator>::merge(unrolled_list& other, Compare comp) {
+    if (this == &other || other.size_ == 0)
+        return;
+    BlockBase* middle = other.end_.next;
+    splice(end(), other);
+    std::inplace_merge(begin(), iterator(middle, 0), end(), comp);
+}
+
+// вставленный последним итератор действителен всегда; от него назад
+// отсчитывается первый вставленный
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+typename unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::insert_many(const_iterator pos, Args&&... args) {
+    if constexpr (sizeof...(Args) == 0) {
+        return iterator(mutableBlock(pos.block_), pos.index_);
+    } else {
+        iterator it;
+        ((it = emplace(pos, std::forward<Args>(args)), pos = std::next(const_iterator(it))), ...);
+        for (size_type i = 1; i < sizeof...(Args); ++i)
+            --it;
+        return it;
+    }
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_UNROLLED_LIST_H
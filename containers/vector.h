@@ -0,0 +1,228 @@
+#ifndef S21_CONTAINERS_VECTOR_H
+#define S21_CONTAINERS_VECTOR_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "execution.h"
+#include "simd.h"
+#include "vector_base.h"
+
+namespace s21 {
+
+template <typename T, typename Allocator = std::allocator<T>>
+class vector : public VectorBase<vector<T, Allocator>, T, Allocator> {
+    using Base = VectorBase<vector<T, Allocator>, T, Allocator>;
+    friend Base;
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = size_t;
+    using allocator_type = Allocator;
+
+    // -------------------  конструкторы и деструкторы -------------------
+    vector() noexcept(noexcept(Allocator())) : Base(nullptr, 0) {}
+    explicit vector(const allocator_type& alloc) noexcept : Base(nullptr, 0, alloc) {}
+    explicit vector(size_type n);
+    vector(std::initializer_list<value_type> const &items);
+    vector(const vector &v);
+    vector(vector &&v) noexcept;
+    ~vector();
+
+    vector& operator=(const vector &v);
+    vector& operator=(vector &&v) noexcept(std::allocator_traits<Allocator>::is_always_equal::value ||
+                                           std::allocator_traits<Allocator>::
+                                               propagate_on_container_move_assignment::value);
+
+    // ------------------- ёмкость и модификаторы -------------------
+    // доступ, вставка и удаление — в VectorBase
+    void shrink_to_fit(); // reduces memory usage by freeing unused memory
+    void swap(vector& other) noexcept;
+
+    // ------------------- сортировка -------------------
+    using Base::sort;
+    // par и par_unseq сортируют куски по числу потоков пула параллельно и
+    // сливают их деревом std::inplace_merge; comp вызывается из разных потоков
+    template <typename ExecutionPolicy, typename Compare,
+              typename = execution::enable_if_execution_policy<ExecutionPolicy>>
+    void sort(ExecutionPolicy&& policy, Compare comp);
+
+private:
+    using typename Base::alloc_traits;
+    using Base::data_;
+    using Base::size_;
+    using Base::capacity_;
+    using Base::alloc_;
+    using Base::relocate;
+    using Base::destroyRange;
+
+    void reallocate(size_type newCapacity);
+    void deallocate() noexcept;
+};
+
+// поэлементное сравнение; для арифметических T — векторным ядром из simd.h
+template <typename T, typename Allocator>
+bool operator==(const vector<T, Allocator>& left, const vector<T, Allocator>& right) {
+    return left.size() == right.size() && simd_equal(left.begin(), left.end(), right.begin());
+}
+
+template <typename T, typename Allocator>
+bool operator!=(const vector<T, Allocator>& left, const vector<T, Allocator>& right) {
+    return !(left == right);
+}
+
+// ------------------------------------- конструкторы и деструкторы -------------------------------------
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(size_type n) : Base(nullptr, 0) {
+    this->constructDefault(n);
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(std::initializer_list<value_type> const &items) : Base(nullptr, 0) {
+    this->constructCopies(items.begin(), items.size());
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector &v)
+    : Base(nullptr, 0, alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+    this->constructCopies(v.data_, v.size_);
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(vector &&v) noexcept : Base(v.data_, v.capacity_, v.alloc_) {
+    size_ = v.size_;
+    v.data_ = nullptr;
+    v.size_ = 0;
+    v.capacity_ = 0;
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::~vector() {
+    this->clear();
+    deallocate();
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>& vector<T, Allocator>::operator=(const vector &v) {
+    if (this != &v) {
+        vector copy(v);
+        swap(copy);
+    }
+    return *this;
+}
+
+// буфер v забирается целиком, только если его сможет освободить наш
+// аллокатор; иначе элементы переносятся по одному в свой буфер
+template <typename T, typename Allocator>
+vector<T, Allocator>& vector<T, Allocator>::operator=(vector &&v) noexcept(
+    std::allocator_traits<Allocator>::is_always_equal::value ||
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+    if (this == &v)
+        return *this;
+    this->clear();
+    if (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value &&
+        !(alloc_ == v.alloc_)) {
+        this->reserve(v.size_);
+        relocate(v.data_, v.data_ + v.size_, data_);
+        size_ = v.size_;
+        v.clear();
+        return *this;
+    }
+    deallocate();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+        alloc_ = v.alloc_;
+    data_ = v.data_;
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+    v.data_ = nullptr;
+    v.size_ = 0;
+    v.capacity_ = 0;
+    return *this;
+}
+
+// --------------------------------------- ёмкость -------------------------------------
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::shrink_to_fit() {
+    if (capacity_ > size_)
+        reallocate(size_);
+}
+
+// --------------------------------------- модификаторы -------------------------------------
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::swap(vector& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    if (alloc_traits::propagate_on_container_swap::value)
+        std::swap(alloc_, other.alloc_);
+}
+
+// --------------------------------------- сортировка -------------------------------------
+
+template <typename T, typename Allocator>
+template <typename ExecutionPolicy, typename Compare, typename>
+void vector<T, Allocator>::sort(ExecutionPolicy&& policy, Compare comp) {
+    if constexpr (std::is_same<typename std::decay<ExecutionPolicy>::type, execution::sequenced_policy>::value) {
+        sort(comp);
+    } else {
+        constexpr size_type kParallelSortGrain = size_type(1) << 14;
+        thread_pool& pool = policy.pool();
+        const size_type runs = std::min(pool.concurrency(), size_ / kParallelSortGrain);
+        if (runs < 2) {
+            sort(comp);
+            return;
+        }
+        auto bound = [this, runs](size_type run) { return data_ + size_ * run / runs; };
+        pool.parallel_for(0, runs, [&bound, &comp](size_type run) {
+            std::sort(bound(run), bound(run + 1), Compare(comp));
+        });
+        // на каждом уровне сливаются пары соседних отсортированных кусков
+        for (size_type width = 1; width < runs; width *= 2) {
+            pool.parallel_for(0, (runs + 2 * width - 1) / (2 * width), [&bound, &comp, runs, width](size_type pair) {
+                const size_type left = pair * 2 * width;
+                if (left + width < runs)
+                    std::inplace_merge(bound(left), bound(left + width), bound(std::min(left + 2 * width, runs)),
+                                       Compare(comp));
+            });
+        }
+    }
+}
+
+// ------------------------------------- работа с памятью -------------------------------------
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::reallocate(size_type newCapacity) {
+    T* newData = newCapacity != 0 ? alloc_traits::allocate(alloc_, newCapacity) : nullptr;
+    try {
+        relocate(data_, data_ + size_, newData);
+    } catch (...) {
+        alloc_traits::deallocate(alloc_, newData, newCapacity);
+        throw;
+    }
+    destroyRange(data_, data_ + size_);
+    deallocate();
+    data_ = newData;
+    capacity_ = newCapacity;
+}
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::deallocate() noexcept {
+    if (data_ != nullptr)
+        alloc_traits::deallocate(alloc_, data_, capacity_);
+    data_ = nullptr;
+    capacity_ = 0;
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_VECTOR_H
@@ -0,0 +1,405 @@
+#ifndef S21_CONTAINERS_VECTOR_BASE_H
+#define S21_CONTAINERS_VECTOR_BASE_H
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Общая часть s21::vector и s21::small_vector: непрерывный буфер
+// [data_, data_ + capacity_), доступ, вставка, удаление и перенос
+// элементов. Откуда берётся буфер, решает наследник (CRTP): он определяет
+//   reallocate(newCapacity) — переносит элементы в буфер новой ёмкости;
+//   deallocate()            — отдаёт буфер и оставляет пустой (data_ и
+//                             capacity_ — те, с которыми контейнер создан).
+// Рост всегда идёт в буфер из аллокатора, поэтому вставке хватает этих двух
+// операций. Конструкторы, присваивания и swap остаются у наследника
+template <typename Derived, typename T, typename Allocator>
+class VectorBase {
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = size_t;
+    using allocator_type = Allocator;
+
+    VectorBase(const VectorBase&) = delete;
+    VectorBase& operator=(const VectorBase&) = delete;
+
+    // -------------------  доступ к элементам -------------------
+    reference at(size_type pos); // access a specified element with bounds checking
+    const_reference at(size_type pos) const;
+    reference operator[](size_type pos) { return data_[pos]; }
+    const_reference operator[](size_type pos) const { return data_[pos]; }
+    reference front() { return data_[0]; }
+    const_reference front() const { return data_[0]; }
+    reference back() { return data_[size_ - 1]; }
+    const_reference back() const { return data_[size_ - 1]; }
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+
+    // ------------------- итераторы -------------------
+    iterator begin() noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    // ------------------- ёмкость -------------------
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type max_size() const noexcept { return alloc_traits::max_size(alloc_); }
+    void reserve(size_type size); // allocate storage of size elements
+    size_type capacity() const noexcept { return capacity_; }
+    allocator_type get_allocator() const { return alloc_; }
+
+    // ------------------- модификаторы -------------------
+    void clear() noexcept;
+    iterator insert(const_iterator pos, const_reference value); // inserts element before pos and returns the iterator that points to the new element
+    iterator insert(const_iterator pos, value_type&& value);
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+    iterator erase(const_iterator pos); // erases element at pos and returns the iterator that points to the next element
+    iterator erase(const_iterator first, const_iterator last);
+    void push_back(const_reference value);
+    void push_back(value_type&& value);
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    void pop_back();
+    template <typename... Args>
+    iterator insert_many(const_iterator pos, Args&&... args);
+    template <typename... Args>
+    void insert_many_back(Args&&... args);
+
+    // ------------------- сортировка -------------------
+    // неустойчивая, как std::sort
+    void sort() { sort(std::less<value_type>()); }
+    template <typename Compare>
+    void sort(Compare comp) { std::sort(begin(), end(), comp); }
+
+protected:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    // элементы можно переносить memcpy: тип тривиально копируемый и
+    // аллокатор не подменяет construct/destroy
+    static constexpr bool kTriviallyRelocatable =
+        std::is_trivially_copyable<T>::value && std::is_same<Allocator, std::allocator<T>>::value;
+
+    VectorBase(T* data, size_type capacity) noexcept(noexcept(Allocator())) : data_(data), capacity_(capacity) {}
+    VectorBase(T* data, size_type capacity, const Allocator& alloc) noexcept
+        : data_(data), capacity_(capacity), alloc_(alloc) {}
+    ~VectorBase() = default;
+
+    // заполнение пустого контейнера из конструктора наследника: если бросит
+    // исключение, деструктор не вызовется, поэтому частично построенные
+    // элементы и буфер освобождаются здесь
+    void constructDefault(size_type n);
+    void constructCopies(const T* first, size_type n);
+
+    size_type growCapacity(size_type required) const;
+    void relocate(T* first, T* last, T* dest);
+    void destroyRange(T* first, T* last) noexcept;
+
+    T* data_;
+    size_type size_ = 0;
+    size_type capacity_;
+    Allocator alloc_;
+
+private:
+    Derived& derived() noexcept { return static_cast<Derived&>(*this); }
+
+    template <typename... Args>
+    reference emplaceBackSlow(Args&&... args);
+};
+
+// ------------------------------------- заполнение -------------------------------------
+
+template <typename Derived, typename T, typename Allocator>
+void VectorBase<Derived, T, Allocator>::constructDefault(size_type n) {
+    reserve(n);
+    try {
+        for (; size_ < n; ++size_)
+            alloc_traits::construct(alloc_, data_ + size_);
+    } catch (...) {
+        clear();
+        derived().deallocate();
+        throw;
+    }
+}
+
+template <typename Derived, typename T, typename Allocator>
+void VectorBase<Derived, T, Allocator>::constructCopies(const T* first, size_type n) {
+    reserve(n);
+    if constexpr (kTriviallyRelocatable) {
+        if (n != 0)
+            std::memcpy(static_cast<void*>(data_), first, n * sizeof(T));
+        size_ = n;
+    } else {
+        try {
+            for (; size_ < n; ++size_)
+                alloc_traits::construct(alloc_, data_ + size_, first[size_]);
+        } catch (...) {
+            clear();
+            derived().deallocate();
+            throw;
+        }
+    }
+}
+
+// --------------------------------------- доступ -------------------------------------
+
+template <typename Derived, typename T, typename Allocator>
+typename VectorBase<Derived, T, Allocator>::reference VectorBase<Derived, T, Allocator>::at(size_type pos) {
+    if (pos >= size_)
+        throw std::out_of_range("Index out of range");
+    return data_[pos];
+}
+
+template <typename Derived, typename T, typename Allocator>
+typename VectorBase<Derived, T, Allocator>::const_reference VectorBase<Derived, T, Allocator>::at(size_type pos) const {
+    if (pos >= size_)
+        throw std::out_of_range("Index out of range");
+    return data_[pos];
+}
+
+// --------------------------------------- ёмкость -------------------------------------
+
+template <typename Derived, typename T, typename Allocator>
+void VectorBase<Derived, T, Allocator>::reserve(size_type size) {
+    if (size > max_size())
+        throw std::length_error("Requested capacity exceeds max_size");
+    if (size > capacity_)
+        derived().reallocate(size);
+}
+
+// --------------------------------------- модификаторы -------------------------------------
+
+template <typename Derived, typename T, typename Allocator>
+void VectorBase<Derived, T, Allocator>::clear() noexcept {
+    destroyRange(data_, data_ + size_);
+    size_ = 0;
+}
+
+template <typename Derived, typename T, typename Allocator>
+typename VectorBase<Derived, T, Allocator>::iterator VectorBase<Derived, T, Allocator>::insert(const_iterator pos,
+                                                                                             const_reference value) {
+    return emplace(pos, value);
+}
+
+template <typename Derived, typename T, typename Allocator>
+typename VectorBase<Derived, T, Allocator>::iterator VectorBase<Derived, T, Allocator>::insert(const_iterator pos,
+                                                                                             value_type&& value) {
+    return emplace(pos, std::move(value));
+}
+
+// в конец — через emplace_back, в середину — новый элемент создаётся
+// заранее (аргументы могут ссылаться на элементы самого вектора), хвост
+// сдвигается на одну позицию и элемент переносится в освободившееся место
+template <typename Derived, typename T, typename Allocator>
+template <typename... Args>
+typename VectorBase<Derived, T, Allocator>::iterator VectorBase<Derived, T, Allocator>::emplace(const_iterator pos,
+                                                                                              Args&&... args) {
+    size_type index = static_cast<size_type>(pos - data_);
+    if (index == size_) {
+        emplace_back(std::forward<Args>(args)...);
+        return data_ + index;
+    }
+    T value(std::forward<Args>(args)...);
+    if (size_ == capacity_)
+        derived().reallocate(growCapacity(size_ + 1));
+    T* position = data_ + index;
+    alloc_traits::construct(alloc_, data_ + size_, std::move(data_[size_ - 1]));
+    ++size_;
+    std::move_backward(position, data_ + size_ - 2, data_ + size_ - 1);
+    *position = std::move(value);
+    return position;
+}
+
+template <typename Derived, typename T, typename Allocator>
+typename VectorBase<Derived, T, Allocator>::iterator VectorBase<Derived, T, Allocator>::erase(const_iterator pos) {
+    return erase(pos, pos + 1);
+}
+
+template <typename Derived, typename T, typename Allocator>
+typename VectorBase<Derived, T, Allocator>::iterator VectorBase<Derived, T, Allocator>::erase(const_iterator first,
+                                                                                            const_iterator last) {
+    T* from = data_ + (first - data_);
+    T* to = data_ + (last - data_);
+    if (from != to) {
+        T* newEnd = std::move(to, data_ + size_, from);
+        destroyRange(newEnd, data_ + size_);
+        size_ = static_cast<size_type>(newEnd - data_);
+    }
+    return from;
+}
+
+template <typename Derived, typename T, typename Allocator>
+void VectorBase<Derived, T, Allocator>::push_back(const_reference value) {
+    emplace_back(value);
+}
+
+template <typename Derived, typename T, typename Allocator>
+void VectorBase<Derived, T, Allocator>::push_back(value_type&& value) {
+    emplace_back(std::move(value));
+}
+
+// при переполнении новый элемент строится в новом буфере до переноса
+// старых, поэтому v.push_back(v[0]) безопасен
+template <typename Derived, typename T, typename Allocator>
+template <typename... Args>
+typename VectorBase<Derived, T, Allocator>::reference VectorBase<Derived, T, Allocator>::emplace_back(Args&&... args) {
+    if (size_ < capacity_) {
+        alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+    return emplaceBackSlow(std::forward<Args>(args)...);
+}
+
+// медленный путь emplace_back вынесен отдельно, чтобы быстрый
+// встраивался в цикл вызывающего
+template <typename Derived, typename T, typename Allocator>
+template <typename... Args>
+typename VectorBase<Derived, T, Allocator>::reference VectorBase<Derived, T, Allocator>::emplaceBackSlow(
+    Args&&... args) {
+    size_type newCapacity = growCapacity(size_ + 1);
+    T* newData = alloc_traits::allocate(alloc_, newCapacity);
+    try {
+        alloc_traits::construct(alloc_, newData + size_, std::forward<Args>(args)...);
+    } catch (...) {
+        alloc_traits::deallocate(alloc_, newData, newCapacity);
+        throw;
+    }
+    try {
+        relocate(data_, data_ + size_, newData);
+    } catch (...) {
+        alloc_traits::destroy(alloc_, newData + size_);
+        alloc_traits::deallocate(alloc_, newData, newCapacity);
+        throw;
+    }
+    destroyRange(data_, data_ + size_);
+    derived().deallocate();
+    data_ = newData;
+    capacity_ = newCapacity;
+    return data_[size_++];
+}
+
+template <typename Derived, typename T, typename Allocator>
+void VectorBase<Derived, T, Allocator>::pop_back() {
+    if (size_ == 0)
+        throw std::out_of_range("Vector is empty");
+    --size_;
+    alloc_traits::destroy(alloc_, data_ + size_);
+}
+
+// буфер расширяется не больше одного раза на всю пачку. Для тривиальных
+// типов значения строятся во временный массив, хвост сдвигается memmove и
+// массив копируется в дыру; для остальных дописываются в конец и поворотом
+// встают перед pos. В обоих случаях аргументы читаются до того, как буфер
+// сменится или сдвинется, поэтому могут ссылаться на элементы этого же
+// вектора, а бросивший конструктор оставляет вектор нетронутым
+template <typename Derived, typename T, typename Allocator>
+template <typename... Args>
+typename VectorBase<Derived, T, Allocator>::iterator VectorBase<Derived, T, Allocator>::insert_many(const_iterator pos,
+                                                                                                  Args&&... args) {
+    size_type index = static_cast<size_type>(pos - data_);
+    if constexpr (kTriviallyRelocatable && sizeof...(Args) != 0) {
+        const size_type count = sizeof...(Args);
+        T values[] = {T(std::forward<Args>(args))...};
+        if (size_ + count > capacity_)
+            derived().reallocate(growCapacity(size_ + count));
+        T* gap = data_ + index;
+        std::memmove(static_cast<void*>(gap + count), gap, (size_ - index) * sizeof(T));
+        std::memcpy(static_cast<void*>(gap), values, sizeof(values));
+        size_ += count;
+    } else {
+        size_type oldSize = size_;
+        insert_many_back(std::forward<Args>(args)...);
+        std::rotate(data_ + index, data_ + oldSize, data_ + size_);
+    }
+    return data_ + index;
+}
+
+// как emplaceBackSlow: при переполнении новые элементы строятся в новом
+// буфере до переноса старых. Если бросит конструктор, уже построенные
+// из этой пачки уничтожаются
+template <typename Derived, typename T, typename Allocator>
+template <typename... Args>
+void VectorBase<Derived, T, Allocator>::insert_many_back(Args&&... args) {
+    const size_type count = sizeof...(Args);
+    const bool grow = size_ + count > capacity_;
+    const size_type newCapacity = grow ? growCapacity(size_ + count) : capacity_;
+    T* target = grow ? alloc_traits::allocate(alloc_, newCapacity) : data_;
+    size_type built = 0;
+    try {
+        ((alloc_traits::construct(alloc_, target + size_ + built, std::forward<Args>(args)), ++built), ...);
+        if (grow)
+            relocate(data_, data_ + size_, target);
+    } catch (...) {
+        destroyRange(target + size_, target + size_ + built);
+        if (grow)
+            alloc_traits::deallocate(alloc_, target, newCapacity);
+        throw;
+    }
+    if (grow) {
+        destroyRange(data_, data_ + size_);
+        derived().deallocate();
+        data_ = target;
+        capacity_ = newCapacity;
+    }
+    size_ += count;
+}
+
+// ------------------------------------- работа с памятью -------------------------------------
+
+// геометрический рост в 2 раза: амортизированно O(1) на push_back. У
+// small_vector первое переполнение встроенного буфера тоже удваивает его
+template <typename Derived, typename T, typename Allocator>
+typename VectorBase<Derived, T, Allocator>::size_type VectorBase<Derived, T, Allocator>::growCapacity(
+    size_type required) const {
+    const size_type maxSize = max_size();
+    if (required > maxSize)
+        throw std::length_error("Vector size exceeds max_size");
+    if (capacity_ >= maxSize / 2)
+        return maxSize;
+    return std::max(required, capacity_ * 2);
+}
+
+// строит копию [first, last) в неинициализированной памяти dest.
+// Тривиальные типы переносятся memcpy, остальные — перемещением, если оно
+// noexcept, иначе копированием (строгая гарантия: при исключении уже
+// построенное в dest уничтожается, а исходные элементы не тронуты).
+// Исходные элементы уничтожает вызывающий
+template <typename Derived, typename T, typename Allocator>
+void VectorBase<Derived, T, Allocator>::relocate(T* first, T* last, T* dest) {
+    if constexpr (kTriviallyRelocatable) {
+        if (first != last)
+            std::memcpy(static_cast<void*>(dest), first, static_cast<size_t>(last - first) * sizeof(T));
+    } else {
+        T* current = dest;
+        try {
+            for (; first != last; ++first, ++current)
+                alloc_traits::construct(alloc_, current, std::move_if_noexcept(*first));
+        } catch (...) {
+            destroyRange(dest, current);
+            throw;
+        }
+    }
+}
+
+template <typename Derived, typename T, typename Allocator>
+void VectorBase<Derived, T, Allocator>::destroyRange(T* first, T* last) noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (; first != last; ++first)
+            alloc_traits::destroy(alloc_, first);
+    }
+}
+
+} // namespace s21
+
+#endif // S21_CONTAINERS_VECTOR_BASE_H
@@ -1,7 +1,35 @@
 #include <gtest/gtest.h>
+#include "containers/algorithms.h"
+#include "containers/array.h"
+#include "containers/flat_map.h"
+#include "containers/flat_set.h"
+#include "containers/intrusive_list.h"
 #include "containers/list.h"
+#include "containers/map.h"
+#include "containers/mpmc_queue.h"
+#include "containers/multiset.h"
+#include "containers/pool_allocator.h"
+#include "containers/queue.h"
+#include "containers/ring_buffer.h"
+#include "containers/set.h"
+#include "containers/simd.h"
+#include "containers/small_vector.h"
+#include "containers/spsc_queue.h"
+#include "containers/stack.h"
+#include "containers/thread_pool.h"
+#include "containers/unordered_map.h"
+#include "containers/unordered_set.h"
+#include "containers/unrolled_list.h"
+#include "containers/vector.h"
+#include <deque>
 #include <iostream>
 #include <list>
+#include <map>
+#include <random>
+#include <set>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 
 
 TEST(list, Constructor_Default) {
@@ -144,18 +172,35 @@ TEST(ListIteratorDecrement, DecrementFromEnd) {
     EXPECT_EQ(*it, 4);
 }
 
-// Тест на декремент итератора, указывающего на начало списка
+// Тест на декремент итератора, указывающего на начало списка:
+// список кольцевой со стражем, поэтому --begin() — это end(), а ещё один шаг назад — хвост
 TEST(ListIteratorDecrement, DecrementFromBegin) {
-    std::list<int> myList = {1, 2, 3, 4, 5};
-    auto it = myList.begin();
-
     s21::list<int> myList_s21 = {1, 2, 3, 4, 5};
     auto it_s21 = myList_s21.begin();
 
-    --it;
     --it_s21;
+    EXPECT_TRUE(it_s21 == myList_s21.end());
+
+    --it_s21;
+    EXPECT_EQ(*it_s21, 5);
+}
+
+// end() пустого списка совпадает с begin(), а ++end() возвращается в голову
+TEST(ListIteratorDecrement, SentinelWrapsAround) {
+    s21::list<int> empty;
+    EXPECT_TRUE(empty.begin() == empty.end());
 
-    EXPECT_EQ(*it, *it_s21);
+    s21::list<int> myList = {1, 2, 3};
+    auto it = myList.end();
+    ++it;
+    EXPECT_EQ(*it, 1);
+    auto last = myList.end();
+    last--;
+    EXPECT_EQ(*last, 3);
+
+    const s21::list<int>& constList = myList;
+    EXPECT_EQ(constList.back(), 3);
+    EXPECT_EQ(*(--constList.end()), 3);
 }
 
 
@@ -259,6 +304,134 @@ TEST(Erase, Last) {
     list.show_list();
 }
 
+TEST(Insert, InsertEmpty) {
+    s21::list<int> list;
+
+    s21::list<int>::iterator it = list.insert(list.begin(), 1);
+
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 1);
+    EXPECT_EQ(list.size(), 1);
+}
+
+TEST(Insert, InsertKeepsLinks) {
+    s21::list<int> list = {1, 4};
+    s21::list<int>::iterator it = list.begin();
+    ++it;
+
+    // вставляем несколько раз подряд перед одним и тем же узлом
+    list.insert(it, 2);
+    list.insert(it, 3);
+
+    std::list<int> expected = {1, 2, 3, 4};
+    auto exp_it = expected.begin();
+    for (auto s21_it = list.begin(); s21_it != list.end(); ++s21_it, ++exp_it) {
+        EXPECT_EQ(*s21_it, *exp_it);
+    }
+
+    // обратный проход по pPrev
+    auto back_it = list.end();
+    for (int value = 4; value >= 1; --value) {
+        --back_it;
+        EXPECT_EQ(*back_it, value);
+    }
+}
+
+TEST(Erase, ReturnsNext) {
+    s21::list<int> list = {1, 2, 3};
+    s21::list<int>::iterator it = list.begin();
+    ++it;
+
+    s21::list<int>::iterator next = list.erase(it);
+
+    EXPECT_EQ(*next, 3);
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 3);
+}
+
+TEST(Erase, SingleElement) {
+    s21::list<int> list = {1};
+
+    s21::list<int>::iterator next = list.erase(list.begin());
+
+    EXPECT_TRUE(next == list.end());
+    EXPECT_TRUE(list.empty());
+    list.push_back(2);
+    EXPECT_EQ(list.front(), 2);
+    EXPECT_EQ(list.back(), 2);
+}
+
+TEST(Erase, EndThrows) {
+    s21::list<int> list = {1, 2, 3};
+    EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+}
+
+TEST(Erase, Range) {
+    s21::list<int> list = {1, 2, 3, 4, 5};
+    auto first = list.begin();
+    ++first;
+    auto last = first;
+    ++last;
+    ++last;
+    ++last;
+
+    auto it = list.erase(first, last);
+
+    EXPECT_EQ(*it, 5);
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_EQ(list[0], 1);
+    EXPECT_EQ(list[1], 5);
+}
+
+TEST(Erase, RangeAll) {
+    s21::list<int> list = {1, 2, 3};
+
+    auto it = list.erase(list.begin(), list.end());
+
+    EXPECT_TRUE(it == list.end());
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(Erase, PopUntilEmpty) {
+    s21::list<int> list = {1, 2};
+    list.pop_front();
+    list.pop_back();
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.pop_front(), std::out_of_range);
+    EXPECT_THROW(list.pop_back(), std::out_of_range);
+}
+
+// вставка и удаление в середине большого списка не должны зависеть от позиции
+TEST(Erase, InsertEraseMiddleChurn) {
+    s21::list<int> list;
+    std::list<int> std_list;
+    for (int i = 0; i < 1000; ++i) {
+        list.push_back(i);
+        std_list.push_back(i);
+    }
+    auto it = list.begin();
+    auto std_it = std_list.begin();
+    for (int i = 0; i < 500; ++i) {
+        ++it;
+        ++std_it;
+    }
+    for (int i = 0; i < 1000; ++i) {
+        it = list.insert(it, -i);
+        std_it = std_list.insert(std_it, -i);
+        if (i % 3 == 0) {
+            it = list.erase(it);
+            std_it = std_list.erase(std_it);
+        }
+    }
+    EXPECT_EQ(list.size(), std_list.size());
+    std_it = std_list.begin();
+    for (auto s21_it = list.begin(); s21_it != list.end(); ++s21_it, ++std_it) {
+        EXPECT_EQ(*s21_it, *std_it);
+    }
+}
+
 // Тестирование доступа к первому элементу непустого списка
 TEST(ListFrontBack, AccessFirstElement) {
     s21::list<int> myList{1, 2, 3, 4, 5};
@@ -324,6 +497,28 @@ TEST(ListSwap, WorksCorrectlyWithEmptyLists) {
 
 
 
+// после swap и move узлы должны смотреть на страж нового владельца
+TEST(ListSwap, SentinelFollowsOwner) {
+    s21::list<int> list1 = {1, 2, 3};
+    s21::list<int> list2;
+    list1.swap(list2);
+    list2.push_back(4);
+    list2.push_front(0);
+    EXPECT_EQ(list2.front(), 0);
+    EXPECT_EQ(list2.back(), 4);
+    EXPECT_EQ(*(--list2.end()), 4);
+    list1.push_back(9);
+    EXPECT_EQ(list1.size(), 1);
+    EXPECT_EQ(list1.front(), 9);
+
+    s21::list<int> moved(std::move(list2));
+    moved.pop_back();
+    moved.pop_front();
+    EXPECT_EQ(moved.front(), 1);
+    EXPECT_EQ(moved.back(), 3);
+    EXPECT_TRUE(list2.begin() == list2.end());
+}
+
 TEST(ListSpliceTest, MoveAllElements) {
     s21::list<int> s21List1, s21List2;
     std::list<int> stdList1, stdList2;
@@ -395,6 +590,225 @@ TEST(ListSplice, SpliceItself) {
     EXPECT_EQ(*it, 3);
 }
 
+// обход в обе стороны: splice обязан держать pPrev в порядке, иначе
+// обратный проход разойдётся с прямым
+template <typename T>
+static void ExpectSameAsStd(const s21::list<T>& list, const std::list<T>& expected) {
+    ASSERT_EQ(list.size(), expected.size());
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    auto rit = expected.rbegin();
+    for (auto it = list.end(); it != list.begin();)
+        ASSERT_EQ(*--it, *rit++);
+}
+
+TEST(ListSplice, SingleNode) {
+    s21::list<int> first = {1, 2, 3, 4};
+    s21::list<int> second = {10, 20};
+    std::list<int> expectedFirst = {1, 2, 3, 4};
+    std::list<int> expectedSecond = {10, 20};
+
+    first.splice(first.end(), second, second.begin());
+    expectedFirst.splice(expectedFirst.end(), expectedSecond, expectedSecond.begin());
+    ExpectSameAsStd(first, expectedFirst);
+    ExpectSameAsStd(second, expectedSecond);
+
+    first.splice(first.begin(), first, std::prev(first.end()));
+    expectedFirst.splice(expectedFirst.begin(), expectedFirst, std::prev(expectedFirst.end()));
+    ExpectSameAsStd(first, expectedFirst);
+
+    // на своё же место и перед следующим — ничего не меняется
+    first.splice(first.begin(), first, first.begin());
+    first.splice(std::next(first.begin()), first, first.begin());
+    ExpectSameAsStd(first, expectedFirst);
+
+    second.splice(second.begin(), first, std::next(first.begin(), 2));
+    expectedSecond.splice(expectedSecond.begin(), expectedFirst, std::next(expectedFirst.begin(), 2));
+    ExpectSameAsStd(first, expectedFirst);
+    ExpectSameAsStd(second, expectedSecond);
+}
+
+TEST(ListSplice, RangesMatchStd) {
+    std::mt19937 gen(17);
+    s21::list<int> lists[3];
+    std::list<int> expected[3];
+    for (int i = 0; i < 60; ++i) {
+        lists[i % 3].push_back(i);
+        expected[i % 3].push_back(i);
+    }
+    for (int step = 0; step < 2000; ++step) {
+        int from = static_cast<int>(gen() % 3);
+        int to = static_cast<int>(gen() % 3);
+        size_t size = expected[from].size();
+        size_t begin = gen() % (size + 1);
+        size_t end = begin + gen() % (size - begin + 1);
+        auto first = std::next(lists[from].begin(), static_cast<long>(begin));
+        auto last = std::next(lists[from].begin(), static_cast<long>(end));
+        auto expectedFirst = std::next(expected[from].begin(), static_cast<long>(begin));
+        auto expectedLast = std::next(expected[from].begin(), static_cast<long>(end));
+        // внутри одного списка pos не должен попасть в [first, last)
+        size_t targetSize = expected[to].size();
+        size_t at = gen() % (targetSize + 1);
+        if (from == to) {
+            at = gen() % (size - (end - begin) + 1);
+            if (at >= begin) at += end - begin;
+        }
+        auto pos = std::next(lists[to].begin(), static_cast<long>(at));
+        auto expectedPos = std::next(expected[to].begin(), static_cast<long>(at));
+        if (step % 2 == 0)
+            lists[to].splice(pos, lists[from], first, last);
+        else
+            lists[to].splice(pos, lists[from], first, last, from == to ? 0 : end - begin);
+        expected[to].splice(expectedPos, expected[from], expectedFirst, expectedLast);
+        for (int i = 0; i < 3; ++i)
+            ExpectSameAsStd(lists[i], expected[i]);
+    }
+}
+
+TEST(ListSplice, WholeListKeepsBackLinks) {
+    s21::list<int> first = {1, 2};
+    s21::list<int> second = {3, 4, 5};
+    first.splice(first.end(), second);
+    ExpectSameAsStd(first, std::list<int>{1, 2, 3, 4, 5});
+    EXPECT_EQ(first.back(), 5);
+    first.push_back(6);
+    ExpectSameAsStd(first, std::list<int>{1, 2, 3, 4, 5, 6});
+    second.push_back(7);
+    ExpectSameAsStd(second, std::list<int>{7});
+}
+
+TEST(ListBulk, RangeAndFillConstructors) {
+    std::vector<int> source = {4, 8, 15, 16, 23, 42};
+    s21::list<int> fromVector(source.begin(), source.end());
+    ExpectSameAsStd(fromVector, std::list<int>(source.begin(), source.end()));
+    std::list<std::string> words = {"a", "bb", "ccc"};
+    s21::list<std::string> fromList(words.begin(), words.end());
+    ExpectSameAsStd(fromList, words);
+    // целые аргументы — это (n, value), а не диапазон
+    s21::list<size_t> filled(3, 7);
+    ExpectSameAsStd(filled, std::list<size_t>{7, 7, 7});
+    s21::list<int> sized(4);
+    ExpectSameAsStd(sized, std::list<int>(4));
+    EXPECT_EQ(sized[3], 0);
+}
+
+TEST(ListBulk, AssignReusesNodes) {
+    s21::list<std::string> list = {"a", "b", "c"};
+    const std::string* first = &list.front();
+    std::vector<std::string> longer = {"x", "y", "z", "w", "v"};
+    list.assign(longer.begin(), longer.end());
+    ExpectSameAsStd(list, std::list<std::string>(longer.begin(), longer.end()));
+    EXPECT_EQ(&list.front(), first);
+    list.assign({"p", "q"});
+    ExpectSameAsStd(list, std::list<std::string>{"p", "q"});
+    EXPECT_EQ(&list.front(), first);
+    list.assign(4, "r");
+    ExpectSameAsStd(list, std::list<std::string>(4, "r"));
+    EXPECT_EQ(&list.front(), first);
+    list.assign(0, "r");
+    EXPECT_TRUE(list.empty());
+    list.push_back("s");
+    ExpectSameAsStd(list, std::list<std::string>{"s"});
+}
+
+TEST(ListBulk, ResizeAndRangeInsert) {
+    s21::list<int> list = {1, 2, 3};
+    std::list<int> expected = {1, 2, 3};
+    EXPECT_EQ(list[2], 3);
+    list.resize(6, 9);
+    expected.resize(6, 9);
+    ExpectSameAsStd(list, expected);
+    list.resize(2);
+    expected.resize(2);
+    ExpectSameAsStd(list, expected);
+    EXPECT_EQ(list[1], 2);
+    list.resize(4);
+    expected.resize(4);
+    ExpectSameAsStd(list, expected);
+
+    std::vector<int> source = {10, 20, 30};
+    auto it = list.insert(std::next(list.begin()), source.begin(), source.end());
+    expected.insert(std::next(expected.begin()), source.begin(), source.end());
+    EXPECT_EQ(*it, 10);
+    ExpectSameAsStd(list, expected);
+    it = list.insert(list.begin(), 2, -1);
+    expected.insert(expected.begin(), 2, -1);
+    EXPECT_TRUE(it == list.begin());
+    ExpectSameAsStd(list, expected);
+    EXPECT_EQ(list[2], 1);
+    it = list.insert(list.end(), source.end(), source.end());
+    EXPECT_TRUE(it == list.end());
+    ExpectSameAsStd(list, expected);
+}
+
+// копия бросает на третьем элементе: список остаётся прежним
+struct ThrowOnThirdCopy {
+    static int copies;
+    int value;
+    ThrowOnThirdCopy(int v) : value(v) {}
+    ThrowOnThirdCopy(const ThrowOnThirdCopy& other) : value(other.value) {
+        if (++copies == 3) throw std::runtime_error("copy");
+    }
+    ThrowOnThirdCopy& operator=(const ThrowOnThirdCopy&) = default;
+};
+int ThrowOnThirdCopy::copies = 0;
+
+TEST(ListBulk, ThrowingInsertLeavesListUnchanged) {
+    std::vector<ThrowOnThirdCopy> source;
+    source.reserve(4);
+    for (int i = 1; i <= 4; ++i) source.emplace_back(i);
+    s21::list<ThrowOnThirdCopy> list;
+    list.emplace_back(100);
+    ThrowOnThirdCopy::copies = 0;
+    EXPECT_THROW(list.insert(list.begin(), source.begin(), source.end()), std::runtime_error);
+    ASSERT_EQ(list.size(), 1u);
+    EXPECT_EQ(list.front().value, 100);
+    ThrowOnThirdCopy::copies = 0;
+    EXPECT_THROW(s21::list<ThrowOnThirdCopy>(source.begin(), source.end()), std::runtime_error);
+}
+
+TEST(ListCopy, AssignReusesNodesAndMatchesSource) {
+    s21::list<int> target = {9, 8, 7, 6};
+    const int* first = &target.front();
+    s21::list<int> longer = {1, 2, 3, 4, 5, 6};
+    target = longer;
+    ExpectSameAsStd(target, std::list<int>{1, 2, 3, 4, 5, 6});
+    EXPECT_EQ(&target.front(), first);
+    s21::list<int> shorter = {5};
+    target = shorter;
+    ExpectSameAsStd(target, std::list<int>{5});
+    EXPECT_EQ(&target.front(), first);
+    target = s21::list<int>();
+    EXPECT_TRUE(target.empty());
+    const s21::list<int>& self = target = longer;
+    target = self;
+    ExpectSameAsStd(target, std::list<int>{1, 2, 3, 4, 5, 6});
+}
+
+TEST(ListCopy, StringsAndConstructor) {
+    s21::list<std::string> source = {"a", "bb", "ccc"};
+    s21::list<std::string> copy(source);
+    ExpectSameAsStd(copy, std::list<std::string>{"a", "bb", "ccc"});
+    s21::list<std::string> target = {"x", "y", "z", "w", "v"};
+    target = source;
+    ExpectSameAsStd(target, std::list<std::string>{"a", "bb", "ccc"});
+    source.front() = "changed";
+    EXPECT_EQ(target.front(), "a");
+    EXPECT_EQ(copy.front(), "a");
+}
+
+TEST(ListCopy, ThrowingCopyLeavesTargetUnchanged) {
+    s21::list<ThrowOnThirdCopy> source;
+    for (int i = 1; i <= 5; ++i) source.emplace_back(i);
+    s21::list<ThrowOnThirdCopy> target;
+    target.emplace_back(100);
+    target.emplace_back(200);
+    ThrowOnThirdCopy::copies = 0;
+    EXPECT_THROW(target = source, std::runtime_error);
+    ASSERT_EQ(target.size(), 2u);
+    EXPECT_EQ(target.front().value, 100);
+    EXPECT_EQ(target.back().value, 200);
+}
+
 TEST(ListReverse, HandleEmptyList) {
     s21::list<int> emptyList;
     emptyList.reverse();
@@ -466,6 +880,55 @@ TEST(ListUnique, NoDuplicates) {
     EXPECT_EQ(i, 5);
 }
 
+TEST(ListUnique, AllDuplicates) {
+    s21::list<int> list = {7, 7, 7, 7};
+    list.unique();
+    EXPECT_EQ(list.size(), 1);
+    EXPECT_EQ(list.front(), 7);
+    EXPECT_EQ(list.back(), 7);
+}
+
+TEST(ListUnique, PredicateComparesWithLastKept) {
+    s21::list<int> list = {1, 2, 3, 7, 8, 9, 20, 21};
+    std::list<int> expected = {1, 2, 3, 7, 8, 9, 20, 21};
+    auto close = [](int kept, int next) { return next - kept <= 2; };
+    EXPECT_EQ(list.unique(close), 5u);
+    expected.unique(close);
+    ExpectSameAsStd(list, expected);
+    EXPECT_EQ(list.unique(), 0u);
+}
+
+TEST(ListRemove, ReturnsRemovedCount) {
+    s21::list<int> list = {5, 1, 5, 2, 5, 3, 5};
+    EXPECT_EQ(list.remove(5), 4u);
+    ExpectSameAsStd(list, std::list<int>{1, 2, 3});
+    EXPECT_EQ(list.remove(42), 0u);
+    EXPECT_EQ(list.remove_if([](int value) { return value % 2 == 1; }), 2u);
+    ExpectSameAsStd(list, std::list<int>{2});
+    EXPECT_EQ(list.remove_if([](int) { return true; }), 1u);
+    EXPECT_TRUE(list.empty());
+    list.push_back(9);
+    ExpectSameAsStd(list, std::list<int>{9});
+}
+
+// значение — ссылка на удаляемый элемент самого списка
+TEST(ListRemove, ValueAliasingAnElement) {
+    s21::list<std::string> list = {"a", "bb", "a", "c", "a"};
+    EXPECT_EQ(list.remove(list.front()), 3u);
+    ExpectSameAsStd(list, std::list<std::string>{"bb", "c"});
+}
+
+TEST(ListRemove, ThrowingPredicateKeepsListConsistent) {
+    s21::list<int> list = {1, 2, 3, 4, 5, 6};
+    int calls = 0;
+    EXPECT_THROW(list.remove_if([&calls](int value) {
+        if (++calls == 4) throw std::runtime_error("stop");
+        return value % 2 == 0;
+    }), std::runtime_error);
+    ExpectSameAsStd(list, std::list<int>{1, 3, 4, 5, 6});
+    EXPECT_EQ(list[2], 4);
+}
+
 TEST(ListSort, SortEmptyList) {
     s21::list<int> list;
     list.sort();
@@ -519,6 +982,103 @@ TEST(ListSort, SortReverseOrder) {
     EXPECT_EQ(actual, expected);
 }
 
+// Тест на сортировку с пользовательским компаратором
+TEST(ListSort, SortWithComparator) {
+    s21::list<int> list = {3, 1, 4, 1, 5, 9, 2, 6};
+    list.sort(std::greater<int>());
+
+    std::vector<int> expected = {9, 6, 5, 4, 3, 2, 1, 1};
+    std::vector<int> actual;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        actual.push_back(*it);
+    }
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(list.front(), 9);
+    EXPECT_EQ(list.back(), 1);
+}
+
+// Тест на устойчивость: равные ключи сохраняют исходный порядок
+TEST(ListSort, SortIsStable) {
+    s21::list<std::pair<int, int>> list;
+    std::list<std::pair<int, int>> std_list;
+    for (int i = 0; i < 200; ++i) {
+        list.push_back({(i * 7) % 5, i});
+        std_list.push_back({(i * 7) % 5, i});
+    }
+    auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.first < b.first;
+    };
+    list.sort(by_key);
+    std_list.sort(by_key);
+
+    auto std_it = std_list.begin();
+    for (auto it = list.begin(); it != list.end(); ++it, ++std_it) {
+        EXPECT_EQ(*it, *std_it);
+    }
+}
+
+// Тест проверяет, что узлы перевешиваются, а не копируются данные
+TEST(ListSort, SortRelinksNodes) {
+    s21::list<std::string> list = {"pear", "apple", "fig"};
+    const std::string* apple = &*(++list.begin());
+    list.sort();
+
+    EXPECT_EQ(&list.front(), apple);
+    EXPECT_EQ(list.back(), "pear");
+
+    // обратный проход по pPrev после сортировки
+    std::vector<std::string> backwards;
+    auto it = list.end();
+    for (size_t i = 0; i < list.size(); ++i) {
+        --it;
+        backwards.push_back(*it);
+    }
+    std::vector<std::string> expected = {"pear", "fig", "apple"};
+    EXPECT_EQ(backwards, expected);
+}
+
+TEST(ListSort, SortMatchesStd) {
+    s21::list<int> list;
+    std::list<int> std_list;
+    unsigned seed = 12345;
+    for (int i = 0; i < 1000; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int value = static_cast<int>((seed >> 16) % 100);
+        list.push_back(value);
+        std_list.push_back(value);
+    }
+    list.sort();
+    std_list.sort();
+
+    EXPECT_EQ(list.size(), std_list.size());
+    auto std_it = std_list.begin();
+    for (auto it = list.begin(); it != list.end(); ++it, ++std_it) {
+        EXPECT_EQ(*it, *std_it);
+    }
+}
+
+TEST(ListSort, ParallelMatchesStableSort) {
+    // ключ повторяется часто, второй член пары проверяет устойчивость
+    std::vector<std::pair<int, int>> values;
+    std::mt19937 gen(21);
+    for (int i = 0; i < 100000; ++i) values.emplace_back(static_cast<int>(gen() % 1000), i);
+    std::vector<std::pair<int, int>> expected = values;
+    auto byKey = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+    for (std::size_t threads : {1u, 3u, 4u}) {
+        s21::thread_pool pool(threads);
+        s21::list<std::pair<int, int>> list(values.begin(), values.end());
+        list.sort(s21::execution::par.on(pool), byKey);
+        ASSERT_EQ(list.size(), expected.size());
+        EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin()));
+        EXPECT_EQ(list.back(), expected.back());
+        EXPECT_EQ(*--list.end(), expected.back());
+    }
+    s21::list<std::pair<int, int>> list(values.begin(), values.end());
+    list.sort(s21::execution::seq, byKey);
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin()));
+}
+
 TEST(List, Merge) {
   s21::list<int> our_list_first = {1};
   s21::list<int> our_list_second = {2, 3, 4, 5};
@@ -555,6 +1115,99 @@ TEST(List, Merge3) {
   EXPECT_EQ(our_list_second.empty(), std_list_second.empty());
 }
 
+TEST(List, MergeSorted) {
+  s21::list<int> our_list_first = {1, 3, 5, 7};
+  s21::list<int> our_list_second = {0, 2, 3, 8, 9};
+  std::list<int> std_list_first = {1, 3, 5, 7};
+  std::list<int> std_list_second = {0, 2, 3, 8, 9};
+  our_list_first.merge(our_list_second);
+  std_list_first.merge(std_list_second);
+  EXPECT_EQ(our_list_first.size(), std_list_first.size());
+  EXPECT_TRUE(our_list_second.empty());
+  auto std_it = std_list_first.begin();
+  for (auto it = our_list_first.begin(); it != our_list_first.end(); ++it, ++std_it) {
+    EXPECT_EQ(*it, *std_it);
+  }
+  // обратный проход по pPrev
+  auto it = our_list_first.end();
+  auto std_rit = std_list_first.rbegin();
+  for (size_t i = 0; i < our_list_first.size(); ++i, ++std_rit) {
+    --it;
+    EXPECT_EQ(*it, *std_rit);
+  }
+}
+
+TEST(List, MergeIntoEmpty) {
+  s21::list<int> our_list_first;
+  s21::list<int> our_list_second = {1, 2};
+  our_list_first.merge(our_list_second);
+  EXPECT_EQ(our_list_first.size(), 2);
+  EXPECT_EQ(our_list_first.front(), 1);
+  EXPECT_EQ(our_list_first.back(), 2);
+  EXPECT_TRUE(our_list_second.empty());
+}
+
+TEST(List, MergeComparatorStable) {
+  using item = std::pair<int, char>;
+  auto by_key = [](const item& a, const item& b) { return a.first > b.first; };
+  s21::list<item> our_list_first = {{5, 'a'}, {3, 'a'}, {1, 'a'}};
+  s21::list<item> our_list_second = {{5, 'b'}, {3, 'b'}, {2, 'b'}};
+  std::list<item> std_list_first = {{5, 'a'}, {3, 'a'}, {1, 'a'}};
+  std::list<item> std_list_second = {{5, 'b'}, {3, 'b'}, {2, 'b'}};
+  our_list_first.merge(our_list_second, by_key);
+  std_list_first.merge(std_list_second, by_key);
+  auto std_it = std_list_first.begin();
+  for (auto it = our_list_first.begin(); it != our_list_first.end(); ++it, ++std_it) {
+    EXPECT_EQ(*it, *std_it);
+  }
+}
+
+TEST(List, MergeAll) {
+  std::vector<s21::list<int>> shards(5);
+  std::list<int> expected;
+  for (int i = 0; i < 100; ++i) {
+    shards[(i * 3) % 5].push_back(i);
+    expected.push_back(i);
+  }
+  s21::list<int> result = {-1, 50};
+  expected.push_back(-1);
+  expected.push_back(50);
+  expected.sort();
+
+  result.merge_all(shards.begin(), shards.end());
+
+  EXPECT_EQ(result.size(), expected.size());
+  for (auto& shard : shards) {
+    EXPECT_TRUE(shard.empty());
+  }
+  auto std_it = expected.begin();
+  for (auto it = result.begin(); it != result.end(); ++it, ++std_it) {
+    EXPECT_EQ(*it, *std_it);
+  }
+  EXPECT_EQ(result.back(), 99);
+}
+
+TEST(List, MergeAllComparatorStable) {
+  using item = std::pair<int, int>;
+  auto by_key = [](const item& a, const item& b) { return a.first < b.first; };
+  std::vector<s21::list<item>> shards(4);
+  for (int shard = 0; shard < 4; ++shard) {
+    for (int key = 0; key < 3; ++key) {
+      shards[shard].push_back({key, shard});
+    }
+  }
+  s21::list<item> result;
+  result.merge_all(shards.begin(), shards.end(), by_key);
+
+  // при равных ключах порядок списков сохраняется
+  auto it = result.begin();
+  for (int key = 0; key < 3; ++key) {
+    for (int shard = 0; shard < 4; ++shard, ++it) {
+      EXPECT_EQ(*it, item(key, shard));
+    }
+  }
+}
+
 TEST(List, Insert_Many_first) {
   s21::list<int> our_list = {1, 2, 3, 4, 5};
   s21::list<int>::iterator our_it = our_list.begin();
@@ -589,6 +1242,19 @@ TEST(List, Insert_Many_second) {
 }
 
 
+TEST(List, Insert_Many_returns_first) {
+  s21::list<int> our_list = {1, 2, 3};
+  auto our_it = our_list.begin();
+  ++our_it;
+  auto first = our_list.insert_many(our_it, 7, 8);
+  EXPECT_EQ(*first, 7);
+  ++first;
+  EXPECT_EQ(*first, 8);
+  ++first;
+  EXPECT_EQ(*first, 2);
+  EXPECT_EQ(our_list.size(), 5);
+}
+
 TEST(List, Insert_Many_back) {
   s21::list<int> our_list = {1, 2, 3, 4, 5};
   our_list.insert_many_back(7, 8);
@@ -629,6 +1295,2263 @@ TEST(List, Insert_Many_empty) {
 }
 
 
+// аллокатор, считающий живые объекты; счётчик общий для всех rebind'ов
+static int live_allocations = 0;
+
+template <typename T>
+struct counting_allocator {
+  using value_type = T;
+
+  counting_allocator() = default;
+  template <typename U>
+  counting_allocator(const counting_allocator<U>&) {}
+
+  T* allocate(size_t n) {
+    live_allocations += static_cast<int>(n);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) {
+    live_allocations -= static_cast<int>(n);
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const counting_allocator&) const { return true; }
+  bool operator!=(const counting_allocator&) const { return false; }
+};
+
+TEST(ListAllocator, AllocatorUsedForEveryNode) {
+  {
+    s21::list<int, counting_allocator<int>> list = {1, 2, 3};
+    EXPECT_EQ(live_allocations, 3);
+    list.push_front(0);
+    list.insert(++list.begin(), 5);
+    EXPECT_EQ(live_allocations, 5);
+    list.pop_back();
+    list.erase(list.begin());
+    EXPECT_EQ(live_allocations, 3);
+    EXPECT_EQ(list.size(), 3);
+  }
+  EXPECT_EQ(live_allocations, 0);
+}
+
+// аллокатор с состоянием: копии равны только внутри одной арены, каждая
+// арена считает свои живые объекты, propagate_on_container_* — false.
+// Буфер, освобождённый не через ту арену, собьёт оба счётчика
+static int arena_live[3] = {};
+
+template <typename T>
+struct arena_allocator {
+  using value_type = T;
+
+  int arena;
+  explicit arena_allocator(int arena) : arena(arena) {}
+  template <typename U>
+  arena_allocator(const arena_allocator<U>& other) : arena(other.arena) {}
+
+  T* allocate(size_t n) {
+    arena_live[arena] += static_cast<int>(n);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) {
+    arena_live[arena] -= static_cast<int>(n);
+    std::allocator<T>().deallocate(p, n);
+  }
+  template <typename U>
+  bool operator==(const arena_allocator<U>& other) const { return arena == other.arena; }
+  template <typename U>
+  bool operator!=(const arena_allocator<U>& other) const { return arena != other.arena; }
+};
+
+TEST(ListAllocator, PoolAllocatorBasicOperations) {
+  s21::list<int, s21::pool_allocator<int>> list = {5, 3, 1};
+  std::list<int> std_list = {5, 3, 1};
+  for (int i = 0; i < 3000; ++i) {
+    list.push_back(i % 17);
+    std_list.push_back(i % 17);
+  }
+  list.pop_front();
+  std_list.pop_front();
+  list.sort();
+  std_list.sort();
+  list.unique();
+  std_list.unique();
+
+  EXPECT_EQ(list.size(), std_list.size());
+  auto std_it = std_list.begin();
+  for (auto it = list.begin(); it != list.end(); ++it, ++std_it) {
+    EXPECT_EQ(*it, *std_it);
+  }
+}
+
+TEST(ListAllocator, PoolAllocatorReusesFreedSlots) {
+  s21::list<int, s21::pool_allocator<int, 4>> list = {1, 2, 3};
+  const int* freed = &list.front();
+  list.pop_front();
+  list.push_back(4);
+  EXPECT_EQ(&list.back(), freed);
+}
+
+TEST(ListAllocator, PoolAllocatorSwapAndMove) {
+  s21::list<std::string, s21::pool_allocator<std::string>> first = {"a", "b"};
+  s21::list<std::string, s21::pool_allocator<std::string>> second = {"c"};
+  first.swap(second);
+  EXPECT_EQ(first.size(), 1);
+  EXPECT_EQ(second.back(), "b");
+
+  s21::list<std::string, s21::pool_allocator<std::string>> moved(std::move(second));
+  EXPECT_TRUE(second.empty());
+  moved.push_back("d");
+  first = std::move(moved);
+  EXPECT_EQ(first.size(), 3);
+  EXPECT_EQ(first.front(), "a");
+  EXPECT_EQ(first.back(), "d");
+  first.merge(second);
+  EXPECT_EQ(first.size(), 3);
+}
+
+TEST(ListAllocator, PoolAllocatorCopyAssign) {
+  s21::list<int, s21::pool_allocator<int>> first = {1, 2, 3, 4};
+  s21::list<int, s21::pool_allocator<int>> second = {7, 8};
+  first = second;
+  first.push_back(9);
+  second.clear();
+  ASSERT_EQ(first.size(), 3);
+  EXPECT_EQ(first.front(), 7);
+  EXPECT_EQ(first.back(), 9);
+}
+
+TEST(ListAllocator, PoolAllocatorTraits) {
+  using alloc = s21::pool_allocator<int>;
+  using traits = std::allocator_traits<alloc>;
+  static_assert(std::is_same<traits::rebind_alloc<double>, s21::pool_allocator<double>>::value,
+                "rebind keeps the pool template");
+  alloc a;
+  alloc b = a;
+  alloc c;
+  EXPECT_TRUE(a == b);
+  EXPECT_TRUE(a != c);
+  int* many = traits::allocate(a, 10);
+  traits::deallocate(a, many, 10);
+}
+
+// перепривязанная копия разделяет пул: A(B(a)) == a, и ячейку можно
+// вернуть через любую из копий
+TEST(ListAllocator, PoolAllocatorRebindSharesPool) {
+  using alloc = s21::pool_allocator<int, 4>;
+  alloc a;
+  s21::pool_allocator<double, 4> rebound(a);
+  EXPECT_TRUE(rebound == a);
+  EXPECT_TRUE(alloc(rebound) == a);
+  EXPECT_TRUE(rebound != alloc());
+  int* slot = alloc(rebound).allocate(1);
+  a.deallocate(slot, 1);
+  EXPECT_EQ(a.allocate(1), slot);
+  a.deallocate(slot, 1);
+
+  s21::list<int, alloc> list(a);
+  list.push_back(1);
+  EXPECT_TRUE(list.get_allocator() == a);
+  const s21::pool_allocator<std::pair<const int, int>> map_alloc;
+  s21::map<int, int> map(std::less<int>(), map_alloc);
+  map.insert({1, 2});
+  EXPECT_TRUE(map.get_allocator() == map_alloc);
+}
+
+// копия контейнера заводит свой пул, присваивание оставляет прежний:
+// несинхронизированный пул не делится между копиями
+TEST(ListAllocator, PoolAllocatorCopiesOwnPool) {
+  s21::map<int, int> first = {{1, 10}, {2, 20}};
+  s21::map<int, int> copy(first);
+  EXPECT_TRUE(copy.get_allocator() != first.get_allocator());
+  s21::map<int, int> assigned = {{5, 50}};
+  const auto assigned_alloc = assigned.get_allocator();
+  assigned = first;
+  EXPECT_TRUE(assigned.get_allocator() == assigned_alloc);
+  EXPECT_TRUE(assigned.get_allocator() != first.get_allocator());
+  copy.insert({3, 30});
+  assigned.insert({4, 40});
+  first.erase(1);
+  EXPECT_EQ(first.size(), 1);
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(assigned.at(4), 40);
+
+  s21::multiset<int> values = {1, 2, 2};
+  s21::multiset<int> other(values);
+  values.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(values.size(), 6);
+  EXPECT_EQ(values.count(2), 4);
+
+  s21::list<int, s21::pool_allocator<int>> list = {1, 2};
+  s21::list<int, s21::pool_allocator<int>> list_copy(list);
+  EXPECT_TRUE(list_copy.get_allocator() != list.get_allocator());
+  list_copy.push_back(3);
+  list.pop_front();
+  EXPECT_EQ(list.front(), 2);
+  EXPECT_EQ(list_copy.size(), 3);
+  list = list_copy;
+  EXPECT_TRUE(list.get_allocator() != list_copy.get_allocator());
+  EXPECT_EQ(list.back(), 3);
+}
+
+
+// тип, считающий свои копирования и перемещения
+struct tracked {
+  static int copies;
+  static int moves;
+  static void reset() { copies = moves = 0; }
+
+  int value;
+  explicit tracked(int value = 0) : value(value) {}
+  tracked(int a, int b) : value(a * 10 + b) {}
+  tracked(const tracked& other) : value(other.value) { ++copies; }
+  tracked(tracked&& other) noexcept : value(other.value) { ++moves; }
+  tracked& operator=(const tracked& other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  tracked& operator=(tracked&& other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+  bool operator<(const tracked& other) const { return value < other.value; }
+  bool operator==(const tracked& other) const { return value == other.value; }
+};
+
+int tracked::copies = 0;
+int tracked::moves = 0;
+
+TEST(ListMoveSemantics, PushRvalueMoves) {
+  s21::list<tracked> list;
+  tracked::reset();
+  list.push_back(tracked(1));
+  list.push_front(tracked(0));
+  tracked value(2);
+  list.insert(list.end(), std::move(value));
+  EXPECT_EQ(tracked::copies, 0);
+  EXPECT_EQ(tracked::moves, 3);
+  EXPECT_EQ(list.front().value, 0);
+  EXPECT_EQ(list.back().value, 2);
+}
+
+TEST(ListMoveSemantics, PushLvalueCopiesOnce) {
+  s21::list<tracked> list;
+  tracked value(5);
+  tracked::reset();
+  list.push_back(value);
+  list.push_front(value);
+  list.insert(list.begin(), value);
+  EXPECT_EQ(tracked::copies, 3);
+  EXPECT_EQ(tracked::moves, 0);
+}
+
+TEST(ListMoveSemantics, EmplaceConstructsInPlace) {
+  s21::list<tracked> list;
+  tracked::reset();
+  tracked& back = list.emplace_back(1, 2);
+  tracked& front = list.emplace_front(3);
+  auto it = list.emplace(++list.begin(), 4, 5);
+  EXPECT_EQ(tracked::copies, 0);
+  EXPECT_EQ(tracked::moves, 0);
+  EXPECT_EQ(back.value, 12);
+  EXPECT_EQ(front.value, 3);
+  EXPECT_EQ((*it).value, 45);
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list[0].value, 3);
+  EXPECT_EQ(list[1].value, 45);
+  EXPECT_EQ(list[2].value, 12);
+}
+
+TEST(ListMoveSemantics, InsertManyForwards) {
+  s21::list<tracked> list;
+  list.emplace_back(100);
+  tracked lvalue(7);
+  tracked::reset();
+  list.insert_many(list.begin(), tracked(1), lvalue, tracked(3));
+  EXPECT_EQ(tracked::copies, 1);
+  EXPECT_EQ(tracked::moves, 2);
+
+  tracked::reset();
+  list.insert_many_back(tracked(8), tracked(9));
+  list.insert_many_front(tracked(-1));
+  EXPECT_EQ(tracked::copies, 0);
+  EXPECT_EQ(tracked::moves, 3);
+
+  std::vector<int> expected = {-1, 1, 7, 3, 100, 8, 9};
+  std::vector<int> actual;
+  for (auto& item : list) actual.push_back(item.value);
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(ListMoveSemantics, InsertManyConstructsFromArgs) {
+  s21::list<std::string> list;
+  list.insert_many_back("one", std::string("two"));
+  list.emplace_back(3, 'x');
+  auto it = list.begin();
+  EXPECT_EQ(*it++, "one");
+  EXPECT_EQ(*it++, "two");
+  EXPECT_EQ(*it, "xxx");
+}
+
+TEST(ListMoveSemantics, AlgorithmsDoNotTouchValues) {
+  s21::list<tracked> first;
+  s21::list<tracked> second;
+  for (int i = 0; i < 20; ++i) {
+    first.emplace_back((i * 7) % 20);
+    second.emplace_back(i);
+  }
+  tracked::reset();
+  first.sort();
+  first.merge(second);
+  first.reverse();
+  first.unique();
+  first.splice(first.begin(), second);
+  s21::list<tracked> moved(std::move(first));
+  first = std::move(moved);
+  EXPECT_EQ(tracked::copies, 0);
+  EXPECT_EQ(tracked::moves, 0);
+  EXPECT_EQ(first.size(), 20);
+}
+
+TEST(ListMoveSemantics, SizeConstructorDefaultConstructs) {
+  tracked::reset();
+  s21::list<tracked> list(4);
+  EXPECT_EQ(tracked::copies, 0);
+  EXPECT_EQ(tracked::moves, 0);
+  EXPECT_EQ(list.size(), 4);
+}
+
+// курсор operator[] должен оставаться верным после любых изменений списка
+TEST(ListIndex, CursorSurvivesModifications) {
+  std::mt19937 gen(9);
+  s21::list<int> list;
+  std::vector<int> expected;
+  for (int i = 0; i < 50; ++i) {
+    list.push_back(i);
+    expected.push_back(i);
+  }
+  for (int step = 0; step < 5000; ++step) {
+    size_t index = gen() % expected.size();
+    ASSERT_EQ(list[index], expected[index]);
+    switch (gen() % 8) {
+      case 0: list.push_front(step); expected.insert(expected.begin(), step); break;
+      case 1: list.push_back(step); expected.push_back(step); break;
+      case 2: list.pop_front(); expected.erase(expected.begin()); break;
+      case 3: list.pop_back(); expected.pop_back(); break;
+      case 4: {
+        auto it = list.begin();
+        for (size_t i = 0; i < index; ++i) ++it;
+        list.insert(it, -step);
+        expected.insert(expected.begin() + static_cast<long>(index), -step);
+        break;
+      }
+      case 5: {
+        auto it = list.begin();
+        for (size_t i = 0; i < index; ++i) ++it;
+        list.erase(it);
+        expected.erase(expected.begin() + static_cast<long>(index));
+        break;
+      }
+      case 6:
+        list.reverse();
+        std::reverse(expected.begin(), expected.end());
+        break;
+      default:
+        break;
+    }
+    if (expected.size() < 10) {
+      list.push_back(step);
+      expected.push_back(step);
+    }
+  }
+  list.sort();
+  std::sort(expected.begin(), expected.end());
+  for (size_t i = 0; i < expected.size(); ++i) ASSERT_EQ(list[i], expected[i]);
+  for (size_t i = expected.size(); i-- > 0;) ASSERT_EQ(list[i], expected[i]);
+  s21::list<int> other = {100, 200};
+  list.swap(other);
+  EXPECT_EQ(list[1], 200);
+  other.splice(other.begin(), list);
+  EXPECT_EQ(other[0], 100);
+  EXPECT_EQ(other[2], expected[0]);
+  EXPECT_THROW(list[0], std::out_of_range);
+}
+
+// маленькие блоки, чтобы деление и слияние срабатывали часто
+template <typename List, typename T>
+static void ExpectSameOrder(const List& list, const std::deque<T>& expected) {
+  ASSERT_EQ(list.size(), expected.size());
+  auto it = expected.begin();
+  for (const T& value : list) ASSERT_EQ(value, *it++);
+  auto back = expected.end();
+  for (auto rit = list.end(); rit != list.begin();) ASSERT_EQ(*--rit, *--back);
+}
+
+TEST(UnrolledList, RandomOperationsMatchDeque) {
+  std::mt19937 gen(15);
+  s21::unrolled_list<std::string, 4> list;
+  std::deque<std::string> expected;
+  for (int step = 0; step < 4000; ++step) {
+    std::string value = std::to_string(step) + "_long_enough_for_the_heap";
+    size_t index = expected.empty() ? 0 : gen() % expected.size();
+    auto it = list.begin();
+    for (size_t i = 0; i < index; ++i) ++it;
+    switch (gen() % 8) {
+      case 0: list.push_front(value); expected.push_front(value); break;
+      case 1: list.push_back(value); expected.push_back(value); break;
+      case 2:
+        if (!expected.empty()) { list.pop_front(); expected.pop_front(); }
+        break;
+      case 3:
+        if (!expected.empty()) { list.pop_back(); expected.pop_back(); }
+        break;
+      case 4:
+      case 6:
+      case 7: {
+        auto inserted = list.insert(it, value);
+        EXPECT_EQ(*inserted, value);
+        expected.insert(expected.begin() + static_cast<long>(index), value);
+        break;
+      }
+      default:
+        if (!expected.empty()) {
+          auto next = list.erase(it);
+          expected.erase(expected.begin() + static_cast<long>(index));
+          if (index < expected.size()) {
+            EXPECT_EQ(*next, expected[index]);
+          } else {
+            EXPECT_TRUE(next == list.end());
+          }
+        }
+        break;
+    }
+    if (!expected.empty()) {
+      ASSERT_EQ(list[index % expected.size()], expected[index % expected.size()]);
+    }
+  }
+  ExpectSameOrder(list, expected);
+  list.reverse();
+  std::reverse(expected.begin(), expected.end());
+  ExpectSameOrder(list, expected);
+  list.sort();
+  std::sort(expected.begin(), expected.end());
+  ExpectSameOrder(list, expected);
+  EXPECT_GE(list.memory_usage(), list.size() * sizeof(std::string));
+}
+
+TEST(UnrolledList, RangeEraseAcrossBlocks) {
+  s21::unrolled_list<int, 4> list;
+  std::deque<int> expected;
+  for (int i = 0; i < 30; ++i) {
+    list.push_back(i);
+    expected.push_back(i);
+  }
+  auto first = std::next(list.begin(), 3);
+  auto last = std::next(list.begin(), 22);
+  auto next = list.erase(first, last);
+  expected.erase(expected.begin() + 3, expected.begin() + 22);
+  EXPECT_EQ(*next, 22);
+  ExpectSameOrder(list, expected);
+  EXPECT_TRUE(list.erase(list.begin(), list.end()) == list.end());
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.memory_usage(), 0u);
+  EXPECT_THROW(list.pop_back(), std::out_of_range);
+  EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+}
+
+TEST(UnrolledList, ListOperations) {
+  s21::unrolled_list<int, 4> list = {5, 1, 4, 1, 1, 3, 9, 2, 6, 5, 5};
+  std::list<int> expected = {5, 1, 4, 1, 1, 3, 9, 2, 6, 5, 5};
+  list.unique();
+  expected.unique();
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+  list.sort();
+  expected.sort();
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+  list.reverse();
+  expected.reverse();
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+
+  s21::unrolled_list<int, 4> other = {7, 8, 9};
+  std::list<int> expectedOther = {7, 8, 9};
+  list.splice(std::next(list.begin(), 2), other);
+  expected.splice(std::next(expected.begin(), 2), expectedOther);
+  EXPECT_TRUE(other.empty());
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+
+  auto it = list.insert_many(std::next(list.begin()), 100, 101, 102);
+  expected.insert(std::next(expected.begin()), {100, 101, 102});
+  EXPECT_EQ(*it, 100);
+  list.insert_many_back(200, 201);
+  list.insert_many_front(-1, -2);
+  expected.insert(expected.end(), {200, 201});
+  expected.insert(expected.begin(), {-1, -2});
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+
+  s21::unrolled_list<int, 4> a = {1, 3, 5, 7, 9, 11};
+  s21::unrolled_list<int, 4> b = {2, 3, 4, 10};
+  a.merge(b);
+  std::vector<int> merged = {1, 2, 3, 3, 4, 5, 7, 9, 10, 11};
+  EXPECT_TRUE(b.empty());
+  EXPECT_TRUE(std::equal(a.begin(), a.end(), merged.begin(), merged.end()));
+}
+
+TEST(UnrolledList, CopyMoveSwap) {
+  s21::unrolled_list<std::string, 3> list = {"a", "b", "c", "d", "e"};
+  s21::unrolled_list<std::string, 3> copy(list);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), list.begin(), list.end()));
+  s21::unrolled_list<std::string, 3> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.back(), "e");
+  copy = moved;
+  EXPECT_EQ(copy.size(), 5u);
+  s21::unrolled_list<std::string, 3> other = {"x"};
+  auto kept = other.begin();
+  other.swap(copy);
+  EXPECT_EQ(copy.front(), "x");
+  EXPECT_EQ(*kept, "x");
+  other = std::move(copy);
+  EXPECT_EQ(other.size(), 1u);
+  EXPECT_EQ(other.front(), "x");
+  s21::unrolled_list<int> sized(100);
+  EXPECT_EQ(sized.size(), 100u);
+  EXPECT_EQ(sized[99], 0);
+}
+
+TEST(UnrolledList, MoveAssignRespectsAllocatorPropagation) {
+  using arena_unrolled = s21::unrolled_list<std::string, 4, arena_allocator<std::string>>;
+  static_assert(!std::is_nothrow_move_assignable<arena_unrolled>::value, "may move element-wise");
+  {
+    arena_unrolled source(arena_allocator<std::string>(1));
+    for (int i = 0; i < 10; ++i) source.push_back(std::to_string(i));
+    arena_unrolled target(arena_allocator<std::string>(2));
+    target.push_back("x");
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().arena, 2);
+    ASSERT_EQ(target.size(), 10);
+    EXPECT_EQ(target.front(), "0");
+    EXPECT_EQ(target.back(), "9");
+    EXPECT_TRUE(source.empty());
+    source.push_back("again");
+
+    arena_unrolled same(arena_allocator<std::string>(2));
+    same.push_back("s");
+    target = std::move(same);
+    EXPECT_EQ(target.size(), 1);
+    EXPECT_EQ(target.front(), "s");
+  }
+  EXPECT_EQ(arena_live[1], 0);
+  EXPECT_EQ(arena_live[2], 0);
+}
+
+
+struct HookedEntry {
+  int key;
+  s21::list_hook hook;
+  s21::list_hook secondHook;
+  bool operator<(const HookedEntry& other) const { return key < other.key; }
+};
+
+struct AutoHookedEntry {
+  int key;
+  s21::auto_unlink_list_hook hook;
+};
+
+using HookedList = s21::intrusive_list<HookedEntry, &HookedEntry::hook>;
+using SecondHookedList = s21::intrusive_list<HookedEntry, &HookedEntry::secondHook>;
+using AutoHookedList = s21::intrusive_list<AutoHookedEntry, &AutoHookedEntry::hook>;
+
+template <typename List>
+static std::vector<int> Keys(const List& list) {
+  std::vector<int> keys;
+  for (const auto& entry : list) keys.push_back(entry.key);
+  return keys;
+}
+
+TEST(IntrusiveList, LinksExistingObjects) {
+  std::vector<HookedEntry> entries(6);
+  for (int i = 0; i < 6; ++i) entries[i].key = i;
+  HookedList list;
+  SecondHookedList reversed;
+  for (auto& entry : entries) {
+    list.push_back(entry);
+    reversed.push_front(entry);
+  }
+  EXPECT_EQ(list.size(), 6u);
+  EXPECT_EQ(&list.front(), &entries[0]);
+  EXPECT_EQ(&reversed.front(), &entries[5]);
+  EXPECT_TRUE(entries[3].hook.is_linked());
+
+  list.remove(entries[3]);
+  EXPECT_FALSE(entries[3].hook.is_linked());
+  EXPECT_TRUE(entries[3].secondHook.is_linked());
+  EXPECT_EQ(Keys(list), (std::vector<int>{0, 1, 2, 4, 5}));
+  EXPECT_EQ(Keys(reversed), (std::vector<int>{5, 4, 3, 2, 1, 0}));
+
+  auto it = list.insert(HookedList::iterator_to(entries[1]), entries[3]);
+  EXPECT_EQ(&*it, &entries[3]);
+  EXPECT_EQ(Keys(list), (std::vector<int>{0, 3, 1, 2, 4, 5}));
+  auto next = list.erase(std::next(list.begin()), std::prev(list.end()));
+  EXPECT_EQ(&*next, &entries[5]);
+  EXPECT_EQ(list.size(), 2u);
+  EXPECT_FALSE(entries[2].hook.is_linked());
+  list.pop_front();
+  list.pop_back();
+  EXPECT_TRUE(list.empty());
+  EXPECT_THROW(list.pop_back(), std::out_of_range);
+  EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+
+  HookedEntry copy = entries[0];
+  EXPECT_FALSE(copy.secondHook.is_linked());
+  reversed.clear();
+  for (auto& entry : entries) EXPECT_FALSE(entry.secondHook.is_linked());
+}
+
+TEST(IntrusiveList, SharedListAlgorithms) {
+  std::mt19937 gen(16);
+  std::vector<HookedEntry> entries(200);
+  HookedList first;
+  HookedList second;
+  std::list<int> expectedFirst;
+  std::list<int> expectedSecond;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    entries[i].key = static_cast<int>(gen() % 50);
+    if (i % 3 == 0) {
+      second.push_back(entries[i]);
+      expectedSecond.push_back(entries[i].key);
+    } else {
+      first.push_back(entries[i]);
+      expectedFirst.push_back(entries[i].key);
+    }
+  }
+  first.sort();
+  second.sort();
+  expectedFirst.sort();
+  expectedSecond.sort();
+  EXPECT_EQ(Keys(first), std::vector<int>(expectedFirst.begin(), expectedFirst.end()));
+  first.merge(second);
+  expectedFirst.merge(expectedSecond);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(first.size(), entries.size());
+  EXPECT_EQ(Keys(first), std::vector<int>(expectedFirst.begin(), expectedFirst.end()));
+  first.reverse();
+  expectedFirst.reverse();
+  EXPECT_EQ(Keys(first), std::vector<int>(expectedFirst.begin(), expectedFirst.end()));
+
+  second.splice(second.end(), first);
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(second.size(), entries.size());
+  first.splice(first.begin(), second, std::next(second.begin(), 5));
+  EXPECT_EQ(first.size(), 1u);
+  EXPECT_EQ(second.size(), entries.size() - 1);
+  HookedList moved(std::move(second));
+  EXPECT_TRUE(second.empty());
+  moved.swap(first);
+  EXPECT_EQ(moved.size(), 1u);
+  EXPECT_EQ(first.size(), entries.size() - 1);
+  second = std::move(first);
+  EXPECT_EQ(second.size(), entries.size() - 1);
+  EXPECT_EQ(&*HookedList::iterator_to(second.back()), &second.back());
+}
+
+TEST(IntrusiveList, AutoUnlinkOnDestruction) {
+  AutoHookedList list;
+  AutoHookedEntry kept{1, {}};
+  list.push_back(kept);
+  {
+    AutoHookedEntry temporary{2, {}};
+    list.push_back(temporary);
+    AutoHookedEntry front{0, {}};
+    list.push_front(front);
+    EXPECT_EQ(Keys(list), (std::vector<int>{0, 1, 2}));
+  }
+  EXPECT_EQ(list.size(), 1u);
+  EXPECT_EQ(&list.front(), &kept);
+  AutoHookedEntry other{3, {}};
+  list.push_back(other);
+  other.hook.unlink();
+  EXPECT_FALSE(other.hook.is_linked());
+  EXPECT_EQ(Keys(list), (std::vector<int>{1}));
+}
+
+TEST(IntrusiveList, MoveToFrontKeepsLruOrder) {
+  std::vector<HookedEntry> entries(8);
+  HookedList lru;
+  for (int i = 0; i < 8; ++i) {
+    entries[i].key = i;
+    lru.push_front(entries[i]);
+  }
+  for (int touched : {3, 7, 3, 0}) lru.splice(lru.begin(), lru, HookedList::iterator_to(entries[touched]));
+  EXPECT_EQ(Keys(lru), (std::vector<int>{0, 3, 7, 6, 5, 4, 2, 1}));
+  EXPECT_EQ(lru.size(), 8u);
+}
+
+TEST(Vector, ConstructDefault) {
+  s21::vector<int> our_vector;
+  std::vector<int> std_vector;
+  EXPECT_EQ(our_vector.size(), std_vector.size());
+  EXPECT_EQ(our_vector.capacity(), 0);
+  EXPECT_TRUE(our_vector.empty());
+  EXPECT_TRUE(our_vector.begin() == our_vector.end());
+}
+
+TEST(Vector, ConstructSize) {
+  s21::vector<std::string> our_vector(3);
+  EXPECT_EQ(our_vector.size(), 3);
+  EXPECT_EQ(our_vector.capacity(), 3);
+  for (size_t i = 0; i < our_vector.size(); ++i) {
+    EXPECT_TRUE(our_vector[i].empty());
+  }
+}
+
+TEST(Vector, ConstructInitializerList) {
+  s21::vector<int> our_vector = {1, 2, 3};
+  EXPECT_EQ(our_vector.size(), 3);
+  EXPECT_EQ(our_vector.front(), 1);
+  EXPECT_EQ(our_vector.back(), 3);
+  EXPECT_EQ(our_vector.data()[1], 2);
+}
+
+TEST(Vector, CopyAndMove) {
+  s21::vector<std::string> our_vector = {"a", "b", "c"};
+  s21::vector<std::string> copy(our_vector);
+  copy[0] = "z";
+  EXPECT_EQ(our_vector[0], "a");
+  EXPECT_EQ(copy.size(), 3);
+
+  s21::vector<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved[0], "z");
+
+  s21::vector<std::string> assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.size(), 3);
+  assigned = our_vector;
+  EXPECT_EQ(assigned[0], "a");
+  assigned.push_back("d");
+  EXPECT_EQ(our_vector.size(), 3);
+}
+
+// при неравных аллокаторах без propagate буфер чужой: элементы
+// переносятся в свой, и каждая арена освобождает только своё
+TEST(Vector, MoveAssignRespectsAllocatorPropagation) {
+  using arena_vector = s21::vector<std::string, arena_allocator<std::string>>;
+  static_assert(!std::is_nothrow_move_assignable<arena_vector>::value, "may move element-wise");
+  static_assert(std::is_nothrow_move_assignable<s21::vector<std::string>>::value, "always steals");
+  {
+    arena_vector source(arena_allocator<std::string>(1));
+    source.push_back("a");
+    source.push_back("b");
+    arena_vector target(arena_allocator<std::string>(2));
+    target.push_back("x");
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().arena, 2);
+    ASSERT_EQ(target.size(), 2);
+    EXPECT_EQ(target[1], "b");
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(arena_live[1], static_cast<int>(source.capacity()));
+    EXPECT_EQ(arena_live[2], static_cast<int>(target.capacity()));
+
+    arena_vector same(arena_allocator<std::string>(2));
+    same.push_back("s");
+    const std::string* buffer = same.data();
+    target = std::move(same);
+    EXPECT_EQ(target.data(), buffer);
+    EXPECT_EQ(target[0], "s");
+  }
+  EXPECT_EQ(arena_live[1], 0);
+  EXPECT_EQ(arena_live[2], 0);
+}
+
+TEST(Vector, At) {
+  s21::vector<int> our_vector = {1, 2, 3};
+  EXPECT_EQ(our_vector.at(2), 3);
+  EXPECT_THROW(our_vector.at(3), std::out_of_range);
+  const s21::vector<int>& const_vector = our_vector;
+  EXPECT_EQ(const_vector.at(0), 1);
+  EXPECT_THROW(const_vector.at(5), std::out_of_range);
+}
+
+TEST(Vector, GeometricGrowth) {
+  s21::vector<int> our_vector;
+  size_t reallocations = 0;
+  size_t capacity = our_vector.capacity();
+  for (int i = 0; i < 1000; ++i) {
+    our_vector.push_back(i);
+    if (our_vector.capacity() != capacity) {
+      ++reallocations;
+      capacity = our_vector.capacity();
+    }
+  }
+  EXPECT_LE(reallocations, 11);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(our_vector[static_cast<size_t>(i)], i);
+  }
+}
+
+TEST(Vector, ReserveAndShrink) {
+  s21::vector<std::string> our_vector = {"a", "b"};
+  our_vector.reserve(100);
+  EXPECT_EQ(our_vector.capacity(), 100);
+  EXPECT_EQ(our_vector.size(), 2);
+  our_vector.reserve(10);
+  EXPECT_EQ(our_vector.capacity(), 100);
+  our_vector.shrink_to_fit();
+  EXPECT_EQ(our_vector.capacity(), 2);
+  EXPECT_EQ(our_vector[1], "b");
+  our_vector.clear();
+  our_vector.shrink_to_fit();
+  EXPECT_EQ(our_vector.capacity(), 0);
+  EXPECT_THROW(our_vector.reserve(our_vector.max_size() + 1), std::length_error);
+}
+
+TEST(Vector, InsertErase) {
+  s21::vector<int> our_vector = {1, 2, 4};
+  std::vector<int> std_vector = {1, 2, 4};
+  auto it = our_vector.insert(our_vector.begin() + 2, 3);
+  std_vector.insert(std_vector.begin() + 2, 3);
+  EXPECT_EQ(*it, 3);
+  our_vector.insert(our_vector.begin(), 0);
+  std_vector.insert(std_vector.begin(), 0);
+  our_vector.insert(our_vector.end(), 5);
+  std_vector.insert(std_vector.end(), 5);
+  it = our_vector.erase(our_vector.begin() + 1);
+  std_vector.erase(std_vector.begin() + 1);
+  EXPECT_EQ(*it, 2);
+  our_vector.erase(our_vector.begin() + 1, our_vector.begin() + 3);
+  std_vector.erase(std_vector.begin() + 1, std_vector.begin() + 3);
+  ASSERT_EQ(our_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(our_vector[i], std_vector[i]);
+  }
+  our_vector.pop_back();
+  our_vector.pop_back();
+  our_vector.pop_back();
+  EXPECT_THROW(our_vector.pop_back(), std::out_of_range);
+}
+
+TEST(Vector, InsertSelfReference) {
+  s21::vector<std::string> our_vector = {"a", "b"};
+  our_vector.shrink_to_fit();
+  our_vector.push_back(our_vector[0]);
+  our_vector.insert(our_vector.begin(), our_vector[2]);
+  EXPECT_EQ(our_vector.size(), 4);
+  EXPECT_EQ(our_vector[0], "a");
+  EXPECT_EQ(our_vector[3], "a");
+}
+
+TEST(Vector, Swap) {
+  s21::vector<int> first = {1, 2, 3};
+  s21::vector<int> second = {4};
+  first.swap(second);
+  EXPECT_EQ(first.size(), 1);
+  EXPECT_EQ(second.size(), 3);
+  EXPECT_EQ(first[0], 4);
+}
+
+TEST(Vector, InsertMany) {
+  s21::vector<int> our_vector = {1, 2, 3};
+  auto it = our_vector.insert_many(our_vector.begin() + 1, 7, 8, 9);
+  EXPECT_EQ(*it, 7);
+  std::vector<int> expected = {1, 7, 8, 9, 2, 3};
+  ASSERT_EQ(our_vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(our_vector[i], expected[i]);
+  }
+  our_vector.insert_many_back(10, 11);
+  EXPECT_EQ(our_vector.back(), 11);
+  EXPECT_EQ(our_vector.size(), 8);
+}
+
+TEST(Vector, InsertManyEmpty) {
+  s21::vector<int> our_vector;
+  our_vector.insert_many(our_vector.begin(), 1, 2);
+  EXPECT_EQ(our_vector.size(), 2);
+  EXPECT_EQ(our_vector[0], 1);
+  our_vector.insert_many_back();
+  EXPECT_EQ(our_vector.size(), 2);
+}
+
+// тривиально копируемый тип, конструктор из отрицательного числа бросает
+struct throwing_convert {
+  int value;
+  throwing_convert(int value) : value(value) {
+    if (value < 0) throw std::invalid_argument("negative");
+  }
+};
+
+template <typename Container>
+std::vector<int> ConvertValues(const Container& container) {
+  std::vector<int> values;
+  for (const throwing_convert& item : container) values.push_back(item.value);
+  return values;
+}
+
+TEST(Vector, InsertManyThrowingConversionLeavesVectorIntact) {
+  static_assert(std::is_trivially_copyable<throwing_convert>::value, "memmove path is under test");
+  s21::vector<throwing_convert> our_vector = {0, 1, 2, 3, 4, 5};
+  const std::vector<int> expected = {0, 1, 2, 3, 4, 5};
+  our_vector.reserve(10);
+  EXPECT_THROW(our_vector.insert_many(our_vector.begin() + 1, 7, -1), std::invalid_argument);
+  EXPECT_EQ(ConvertValues(our_vector), expected);
+  our_vector.shrink_to_fit();
+  EXPECT_THROW(our_vector.insert_many(our_vector.begin() + 1, 7, -1), std::invalid_argument);
+  EXPECT_EQ(ConvertValues(our_vector), expected);
+  EXPECT_THROW(our_vector.insert_many_back(7, -1), std::invalid_argument);
+  EXPECT_EQ(ConvertValues(our_vector), expected);
+  EXPECT_EQ(our_vector.capacity(), 6);
+}
+
+// аргументы, ссылающиеся на элементы самого вектора, при полном буфере
+TEST(Vector, InsertManySelfReference) {
+  s21::vector<std::string> strings = {"a", "b"};
+  strings.shrink_to_fit();
+  strings.insert_many_back(strings[0], strings[1]);
+  ASSERT_EQ(strings.size(), 4);
+  EXPECT_EQ(strings.capacity(), 4);
+  strings.insert_many(strings.begin(), strings[3], strings[0]);
+  EXPECT_EQ(std::vector<std::string>(strings.begin(), strings.end()),
+            (std::vector<std::string>{"b", "a", "a", "b", "a", "b"}));
+
+  s21::vector<int> numbers = {1, 2, 3};
+  numbers.shrink_to_fit();
+  numbers.insert_many(numbers.begin() + 1, numbers[0], numbers[2]);
+  numbers.shrink_to_fit();
+  numbers.insert_many_back(numbers[4], numbers[0]);
+  EXPECT_EQ(std::vector<int>(numbers.begin(), numbers.end()), (std::vector<int>{1, 1, 3, 2, 3, 3, 1}));
+}
+
+TEST(Vector, NoCopiesOnGrowthWithNoexceptMove) {
+  s21::vector<tracked> our_vector;
+  tracked::reset();
+  for (int i = 0; i < 100; ++i) {
+    our_vector.emplace_back(i);
+  }
+  our_vector.insert_many_back(tracked(100), tracked(101));
+  our_vector.insert_many(our_vector.begin(), tracked(-1));
+  EXPECT_EQ(tracked::copies, 0);
+  EXPECT_EQ(our_vector[0].value, -1);
+  EXPECT_EQ(our_vector[102].value, 101);
+}
+
+// тип с бросающим перемещением: при росте вектор обязан копировать
+struct throwing_move {
+  static int copies;
+  int value;
+  explicit throwing_move(int value = 0) : value(value) {}
+  throwing_move(const throwing_move& other) : value(other.value) { ++copies; }
+  throwing_move(throwing_move&& other) : value(other.value) {}
+  throwing_move& operator=(const throwing_move&) = default;
+  throwing_move& operator=(throwing_move&&) = default;
+};
+
+int throwing_move::copies = 0;
+
+TEST(Vector, CopiesWhenMoveMayThrow) {
+  s21::vector<throwing_move> our_vector;
+  our_vector.emplace_back(1);
+  throwing_move::copies = 0;
+  our_vector.emplace_back(2);
+  EXPECT_EQ(throwing_move::copies, 1);
+}
+
+// копия бросает на заданном по счёту вызове
+struct copy_bomb {
+  static int countdown;
+  int value;
+  explicit copy_bomb(int value = 0) : value(value) {}
+  copy_bomb(const copy_bomb& other) : value(other.value) {
+    if (--countdown == 0) throw std::runtime_error("boom");
+  }
+  copy_bomb& operator=(const copy_bomb&) = default;
+};
+
+int copy_bomb::countdown = 0;
+
+TEST(Vector, StrongGuaranteeOnReallocation) {
+  s21::vector<copy_bomb> our_vector;
+  our_vector.reserve(3);
+  for (int i = 0; i < 3; ++i) our_vector.emplace_back(i);
+  copy_bomb::countdown = 2;
+  EXPECT_THROW(our_vector.emplace_back(3), std::runtime_error);
+  EXPECT_EQ(our_vector.size(), 3);
+  EXPECT_EQ(our_vector.capacity(), 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(our_vector[static_cast<size_t>(i)].value, i);
+  }
+  copy_bomb::countdown = 2;
+  EXPECT_THROW(s21::vector<copy_bomb> copy(our_vector), std::runtime_error);
+}
+
+
+TEST(Vector, ParallelSortMatchesStd) {
+  std::vector<int> values;
+  std::mt19937 gen(23);
+  for (int i = 0; i < 100000; ++i) values.push_back(static_cast<int>(gen() % 5000));
+  std::vector<int> expected = values;
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+  for (std::size_t threads : {1u, 2u, 5u}) {
+    s21::thread_pool pool(threads);
+    s21::vector<int> our_vector;
+    for (int value : values) our_vector.push_back(value);
+    our_vector.sort(s21::execution::par_unseq.on(pool), std::greater<int>());
+    EXPECT_TRUE(std::equal(our_vector.begin(), our_vector.end(), expected.begin()));
+  }
+  s21::vector<int> small = {3, 1, 2};
+  small.sort(s21::execution::par, std::less<int>());
+  small.sort();
+  EXPECT_EQ(small[0], 1);
+  EXPECT_EQ(small[2], 3);
+}
+
+TEST(SmallVector, StaysInlineUpToN) {
+  {
+    s21::small_vector<std::string, 4, counting_allocator<std::string>> our_vector;
+    EXPECT_EQ(our_vector.capacity(), 4);
+    for (int i = 0; i < 4; ++i) our_vector.push_back(std::to_string(i));
+    our_vector.erase(our_vector.begin() + 1);
+    our_vector.insert(our_vector.begin() + 1, "1");
+    EXPECT_EQ(live_allocations, 0);
+    EXPECT_EQ(our_vector.capacity(), 4);
+    our_vector.push_back(our_vector[0]);
+    EXPECT_EQ(live_allocations, 8);
+    EXPECT_EQ(our_vector.capacity(), 8);
+    EXPECT_EQ(our_vector.size(), 5);
+    EXPECT_EQ(our_vector[4], "0");
+    our_vector.pop_back();
+    our_vector.shrink_to_fit();
+    EXPECT_EQ(live_allocations, 0);
+    EXPECT_EQ(our_vector.capacity(), 4);
+    EXPECT_EQ(our_vector[3], "3");
+    our_vector.reserve(6);
+    EXPECT_EQ(live_allocations, 6);
+    EXPECT_THROW(our_vector.at(4), std::out_of_range);
+  }
+  EXPECT_EQ(live_allocations, 0);
+}
+
+TEST(SmallVector, MatchesVectorOperations) {
+  s21::small_vector<int, 3> our_vector = {1, 2, 4};
+  std::vector<int> std_vector = {1, 2, 4};
+  our_vector.insert(our_vector.begin() + 2, 3);
+  std_vector.insert(std_vector.begin() + 2, 3);
+  auto it = our_vector.insert_many(our_vector.begin() + 1, 7, 8, 9);
+  std_vector.insert(std_vector.begin() + 1, {7, 8, 9});
+  EXPECT_EQ(*it, 7);
+  our_vector.insert_many_back(10, 11);
+  std_vector.insert(std_vector.end(), {10, 11});
+  our_vector.erase(our_vector.begin(), our_vector.begin() + 2);
+  std_vector.erase(std_vector.begin(), std_vector.begin() + 2);
+  our_vector.emplace(our_vector.begin(), 0);
+  std_vector.emplace(std_vector.begin(), 0);
+  ASSERT_EQ(our_vector.size(), std_vector.size());
+  EXPECT_TRUE(std::equal(our_vector.begin(), our_vector.end(), std_vector.begin()));
+  our_vector.sort();
+  EXPECT_TRUE(std::is_sorted(our_vector.begin(), our_vector.end()));
+  s21::small_vector<int, 3> copy(our_vector);
+  EXPECT_TRUE(copy == our_vector);
+  copy.back() = -1;
+  EXPECT_TRUE(copy != our_vector);
+  s21::small_vector<tracked, 2> tracked_vector;
+  tracked_vector.insert_many(tracked_vector.begin(), tracked(1), tracked(2), tracked(3));
+  EXPECT_EQ(tracked_vector[2].value, 3);
+  our_vector.clear();
+  EXPECT_THROW(our_vector.pop_back(), std::out_of_range);
+}
+
+// те же проверки, что у Vector.InsertMany*, во встроенном буфере и в куче
+TEST(SmallVector, InsertManyThrowingConversionLeavesVectorIntact) {
+  s21::small_vector<throwing_convert, 8> inline_vector = {0, 1, 2, 3, 4, 5};
+  s21::small_vector<throwing_convert, 4> heap_vector = {0, 1, 2, 3, 4, 5};
+  const std::vector<int> expected = {0, 1, 2, 3, 4, 5};
+  EXPECT_THROW(inline_vector.insert_many(inline_vector.begin() + 1, 7, -1), std::invalid_argument);
+  EXPECT_THROW(inline_vector.insert_many(inline_vector.begin() + 1, 7, 8, -1), std::invalid_argument);
+  EXPECT_THROW(inline_vector.insert_many_back(7, -1), std::invalid_argument);
+  EXPECT_EQ(ConvertValues(inline_vector), expected);
+  EXPECT_EQ(inline_vector.capacity(), 8);
+  heap_vector.shrink_to_fit();
+  EXPECT_THROW(heap_vector.insert_many(heap_vector.begin() + 1, 7, -1), std::invalid_argument);
+  EXPECT_THROW(heap_vector.insert_many_back(7, -1), std::invalid_argument);
+  EXPECT_EQ(ConvertValues(heap_vector), expected);
+  EXPECT_EQ(heap_vector.capacity(), 6);
+}
+
+TEST(SmallVector, InsertManySelfReference) {
+  using strings = std::vector<std::string>;
+  s21::small_vector<std::string, 4> our_vector = {"a", "b"};
+  our_vector.insert_many_back(our_vector[0], our_vector[1]);
+  EXPECT_EQ(our_vector.capacity(), 4);
+  // полный встроенный буфер переезжает в кучу
+  our_vector.insert_many(our_vector.begin(), our_vector[3], our_vector[0]);
+  EXPECT_EQ(strings(our_vector.begin(), our_vector.end()), (strings{"b", "a", "a", "b", "a", "b"}));
+  our_vector.shrink_to_fit();
+  // полный буфер в куче
+  our_vector.insert_many_back(our_vector[5], our_vector[0]);
+  EXPECT_EQ(strings(our_vector.begin(), our_vector.end()), (strings{"b", "a", "a", "b", "a", "b", "b", "b"}));
+
+  s21::small_vector<int, 3> numbers = {1, 2, 3};
+  numbers.insert_many(numbers.begin() + 1, numbers[0], numbers[2]);
+  numbers.shrink_to_fit();
+  numbers.insert_many_back(numbers[4], numbers[0]);
+  EXPECT_EQ(std::vector<int>(numbers.begin(), numbers.end()), (std::vector<int>{1, 1, 3, 2, 3, 3, 1}));
+}
+
+// перемещение и swap во всех сочетаниях встроенного буфера и кучи
+TEST(SmallVector, MoveAndSwapAcrossStorage) {
+  using strings = s21::small_vector<std::string, 3>;
+  const strings small = {"a", "b"};
+  const strings large = {"p", "q", "r", "s", "t"};
+  for (int first_large = 0; first_large < 2; ++first_large) {
+    for (int second_large = 0; second_large < 2; ++second_large) {
+      strings first = first_large ? large : small;
+      strings second = second_large ? large : small;
+      second.push_back("z");
+      const strings first_before = first;
+      const strings second_before = second;
+      first.swap(second);
+      EXPECT_TRUE(first == second_before);
+      EXPECT_TRUE(second == first_before);
+      EXPECT_EQ(first.capacity() == 3, first.size() <= 3);
+      EXPECT_EQ(second.capacity() == 3, second.size() <= 3);
+
+      strings moved(std::move(first));
+      EXPECT_TRUE(moved == second_before);
+      EXPECT_TRUE(first.empty());
+      EXPECT_EQ(first.capacity(), 3);
+      first = std::move(second);
+      EXPECT_TRUE(first == first_before);
+      EXPECT_TRUE(second.empty());
+      second = first;
+      EXPECT_TRUE(second == first_before);
+    }
+  }
+}
+
+TEST(SmallVector, SwapSelfAndNoCopiesWithNoexceptMove) {
+  s21::small_vector<tracked, 4> first;
+  s21::small_vector<tracked, 4> second;
+  for (int i = 0; i < 3; ++i) first.emplace_back(i);
+  for (int i = 0; i < 6; ++i) second.emplace_back(10 + i);
+  tracked::reset();
+  first.swap(second);
+  first.swap(first);
+  s21::small_vector<tracked, 4> moved(std::move(second));
+  EXPECT_EQ(tracked::copies, 0);
+  EXPECT_EQ(first.size(), 6);
+  EXPECT_EQ(first[5].value, 15);
+  EXPECT_EQ(moved[2].value, 2);
+}
+
+// таблицы s21::array строятся и проверяются при компиляции: если что-то
+// из этого перестанет быть constexpr, тест не соберётся
+constexpr s21::array<int, 16> MakeSquaresDescending() {
+  s21::array<int, 16> table{};
+  for (std::size_t i = 0; i < table.size(); ++i) table[i] = static_cast<int>(i * i) - 50;
+  s21::constexpr_sort(table.begin(), table.end(), std::greater<>());
+  return table;
+}
+
+constexpr s21::array<int, 8> MakeFilledAndSwapped() {
+  s21::array<int, 8> first{};
+  s21::array<int, 8> second{};
+  first.fill(3);
+  second.fill(7);
+  first.swap(second);
+  first.back() = 1;
+  return first;
+}
+
+constexpr s21::array<int, 200> MakeShuffledSorted() {
+  s21::array<int, 200> table{};
+  unsigned seed = 1;
+  for (int& value : table) {
+    seed = seed * 1103515245u + 12345u;
+    value = static_cast<int>((seed >> 16) % 1000);
+  }
+  s21::constexpr_sort(table.begin(), table.end());
+  return table;
+}
+
+constexpr bool IsSorted(const s21::array<int, 200>& table) {
+  for (std::size_t i = 1; i < table.size(); ++i) {
+    if (table[i] < table[i - 1]) return false;
+  }
+  return true;
+}
+
+constexpr auto kSquares = MakeSquaresDescending();
+static_assert(kSquares.front() == 225 - 50 && kSquares.back() == -50, "sorted descending");
+static_assert(kSquares.size() == 16 && !kSquares.empty() && kSquares.max_size() == 16);
+static_assert(*s21::constexpr_find(kSquares.begin(), kSquares.end(), 14) == 14);
+static_assert(s21::constexpr_find(kSquares.begin(), kSquares.end(), 15) == kSquares.end());
+static_assert(s21::constexpr_lower_bound(kSquares.begin(), kSquares.end(), 0, std::greater<>()) - kSquares.begin() == 8);
+static_assert(IsSorted(MakeShuffledSorted()));
+constexpr auto kSwapped = MakeFilledAndSwapped();
+static_assert(kSwapped[0] == 7 && kSwapped.back() == 1 && kSwapped.at(6) == 7);
+static_assert(s21::array<int, 3>{1, 2, 3} == s21::array<int, 3>{1, 2, 3});
+static_assert(s21::array<int, 3>{1, 2, 3} < s21::array<int, 3>{1, 3, 0});
+static_assert(s21::array<int, 3>{1, 2, 3} >= s21::array<int, 3>{1, 2, 3});
+constexpr s21::array<int, 0> kEmptyArray{};
+static_assert(kEmptyArray.empty() && kEmptyArray.begin() == kEmptyArray.end());
+static_assert(std::is_aggregate_v<s21::array<std::string, 2>>);
+
+TEST(Array, RuntimeAccessAndBounds) {
+  s21::array<std::string, 3> words = {"c", "a", "b"};
+  EXPECT_EQ(words.at(0), "c");
+  EXPECT_THROW(words.at(3), std::out_of_range);
+  s21::constexpr_sort(words.begin(), words.end());
+  EXPECT_EQ(words.front(), "a");
+  EXPECT_EQ(words.back(), "c");
+  s21::array<std::string, 3> copy = words;
+  EXPECT_TRUE(copy == words);
+  copy[1] = "z";
+  EXPECT_TRUE(words < copy);
+  words.swap(copy);
+  EXPECT_EQ(words[1], "z");
+  EXPECT_EQ(*s21::constexpr_lower_bound(copy.begin(), copy.end(), std::string("b")), "b");
+}
+
+TEST(Array, SimdFillAndEquality) {
+  // достаточно большой массив идёт через ядра simd.h
+  s21::array<int, 100> first{};
+  s21::array<int, 100> second{};
+  first.fill(9);
+  second.fill(9);
+  EXPECT_EQ(std::count(first.begin(), first.end(), 9), 100);
+  EXPECT_TRUE(first == second);
+  second[99] = 8;
+  EXPECT_TRUE(first != second);
+  EXPECT_TRUE(second < first);
+  s21::array<double, 20> values{};
+  values.fill(0.5);
+  EXPECT_DOUBLE_EQ(s21::simd_sum(values.begin(), values.end()), 10.0);
+}
+
+// дерево напрямую: после каждой операции проверяются все инварианты
+struct tree_identity {
+  const int& operator()(const int& value) const { return value; }
+};
+
+using int_tree = s21::tree<int, int, tree_identity, std::less<int>, std::allocator<int>>;
+
+TEST(Tree, RandomInsertEraseKeepsInvariants) {
+  int_tree tree;
+  std::multiset<int> expected;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 4000; ++i) {
+    int key = static_cast<int>(gen() % 500);
+    if (gen() % 3 != 0 || expected.empty()) {
+      tree.insertEqual(key);
+      expected.insert(key);
+    } else {
+      EXPECT_EQ(tree.erase(key), expected.erase(key));
+    }
+    if (i % 97 == 0) {
+      ASSERT_TRUE(tree.verify());
+    }
+  }
+  ASSERT_TRUE(tree.verify());
+  ASSERT_EQ(tree.size(), expected.size());
+  auto it = tree.begin();
+  for (int value : expected) EXPECT_EQ(*it++, value);
+  EXPECT_TRUE(it == tree.end());
+}
+
+TEST(Tree, SequentialInsertStaysBalanced) {
+  int_tree tree;
+  for (int i = 0; i < 1024; ++i) tree.emplaceHintEqual(tree.end(), i);
+  ASSERT_TRUE(tree.verify());
+  for (int i = 0; i < 1024; i += 2) tree.erase(i);
+  ASSERT_TRUE(tree.verify());
+  EXPECT_EQ(tree.size(), 512);
+  EXPECT_EQ(*tree.begin(), 1);
+  EXPECT_EQ(*--tree.end(), 1023);
+}
+
+TEST(Tree, IteratorWalksBothWays) {
+  int_tree tree;
+  for (int key : {5, 1, 9, 3, 7}) tree.insertUnique(key);
+  std::vector<int> backward;
+  for (auto it = tree.end(); it != tree.begin();) backward.push_back(*--it);
+  EXPECT_EQ(backward, (std::vector<int>{9, 7, 5, 3, 1}));
+  int_tree single;
+  single.insertUnique(42);
+  EXPECT_TRUE(++single.begin() == single.end());
+  EXPECT_EQ(*--single.end(), 42);
+}
+
+TEST(Tree, CopyKeepsShape) {
+  int_tree tree;
+  for (int i = 0; i < 300; ++i) tree.insertUnique((i * 37) % 300);
+  int_tree copy(tree);
+  ASSERT_TRUE(copy.verify());
+  EXPECT_TRUE(std::equal(tree.begin(), tree.end(), copy.begin(), copy.end()));
+  int_tree assigned;
+  assigned.insertUnique(-1);
+  assigned = copy;
+  EXPECT_TRUE(assigned.verify());
+  EXPECT_EQ(assigned.size(), 300);
+}
+
+TEST(Map, Basics) {
+  s21::map<int, std::string> our_map = {{1, "one"}, {2, "two"}, {3, "three"}};
+  EXPECT_EQ(our_map.size(), 3);
+  EXPECT_EQ(our_map.at(2), "two");
+  EXPECT_THROW(our_map.at(4), std::out_of_range);
+  our_map[4] = "four";
+  EXPECT_EQ(our_map.size(), 4);
+  EXPECT_EQ(our_map[4], "four");
+  EXPECT_TRUE(our_map.contains(1));
+  EXPECT_FALSE(our_map.contains(5));
+}
+
+TEST(Map, InsertVariants) {
+  s21::map<std::string, int> our_map;
+  EXPECT_TRUE(our_map.insert({"b", 2}).second);
+  EXPECT_FALSE(our_map.insert({"b", 20}).second);
+  EXPECT_EQ(our_map.at("b"), 2);
+  auto result = our_map.insert("a", 1);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(result.first->first, "a");
+  EXPECT_FALSE(our_map.insert_or_assign("a", 10).second);
+  EXPECT_EQ(our_map.at("a"), 10);
+  EXPECT_TRUE(our_map.insert_or_assign("c", 3).second);
+  std::vector<std::string> keys;
+  for (const auto& item : our_map) keys.push_back(item.first);
+  EXPECT_EQ(keys, (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST(Map, HintedInsert) {
+  s21::map<int, int> our_map;
+  auto hint = our_map.end();
+  for (int i = 0; i < 100; ++i) hint = our_map.insert(our_map.end(), {i, i * i});
+  EXPECT_EQ(hint->first, 99);
+  // неверная подсказка не ломает порядок
+  our_map.insert(our_map.begin(), {1000, 0});
+  our_map.insert(our_map.find(50), {-5, 0});
+  auto existing = our_map.insert(our_map.begin(), {10, 0});
+  EXPECT_EQ(existing->second, 100);
+  EXPECT_EQ(our_map.size(), 102);
+  EXPECT_EQ(our_map.begin()->first, -5);
+  EXPECT_EQ((--our_map.end())->first, 1000);
+}
+
+TEST(Map, EraseAndLookup) {
+  s21::map<int, int> our_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 200; ++i) {
+    our_map[(i * 7) % 200] = i;
+    std_map[(i * 7) % 200] = i;
+  }
+  for (int i = 0; i < 200; i += 3) {
+    our_map.erase(our_map.find(i));
+    std_map.erase(i);
+  }
+  EXPECT_EQ(our_map.erase(1000), 0);
+  ASSERT_EQ(our_map.size(), std_map.size());
+  auto it = our_map.begin();
+  for (const auto& item : std_map) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ(it->second, item.second);
+    ++it;
+  }
+  EXPECT_EQ(our_map.lower_bound(3)->first, 4);
+  EXPECT_EQ(our_map.upper_bound(4)->first, 5);
+  EXPECT_THROW(our_map.erase(our_map.end()), std::out_of_range);
+}
+
+TEST(Map, SwapMoveMerge) {
+  s21::map<int, int> first = {{1, 1}, {2, 2}};
+  s21::map<int, int> second = {{2, 20}, {3, 30}};
+  first.merge(second);
+  EXPECT_EQ(first.size(), 3);
+  EXPECT_EQ(first.at(2), 2);
+  ASSERT_EQ(second.size(), 1);
+  EXPECT_EQ(second.begin()->second, 20);
+
+  first.swap(second);
+  EXPECT_EQ(first.size(), 1);
+  EXPECT_EQ(second.size(), 3);
+  s21::map<int, int> moved(std::move(second));
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(moved.size(), 3);
+  second = std::move(moved);
+  EXPECT_EQ(second.at(3), 30);
+  second[4] = 40;
+  moved[5] = 50;
+  EXPECT_EQ(moved.size(), 1);
+}
+
+TEST(Map, InsertMany) {
+  s21::map<int, char> our_map = {{2, 'b'}};
+  auto result = our_map.insert_many(std::make_pair(1, 'a'), std::make_pair(2, 'x'),
+                                    std::make_pair(3, 'c'));
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(result[1].first->second, 'b');
+  EXPECT_EQ(result[2].first->first, 3);
+  EXPECT_EQ(our_map.size(), 3);
+}
+
+TEST(Set, Basics) {
+  s21::set<int> our_set = {5, 1, 3, 1};
+  EXPECT_EQ(our_set.size(), 3);
+  EXPECT_EQ(*our_set.begin(), 1);
+  EXPECT_FALSE(our_set.insert(3).second);
+  EXPECT_TRUE(our_set.insert(4).second);
+  EXPECT_TRUE(our_set.contains(4));
+  EXPECT_EQ(*our_set.find(5), 5);
+  EXPECT_TRUE(our_set.find(2) == our_set.end());
+  our_set.erase(our_set.find(1));
+  EXPECT_EQ(*our_set.begin(), 3);
+  EXPECT_EQ(our_set.erase(3), 1);
+  EXPECT_EQ(our_set.size(), 2);
+}
+
+TEST(Set, InsertManyAndMerge) {
+  s21::set<std::string> our_set = {"b"};
+  auto result = our_set.insert_many("a", "b", std::string("c"));
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(*result[2].first, "c");
+  s21::set<std::string> other = {"c", "d"};
+  our_set.merge(other);
+  EXPECT_EQ(our_set.size(), 4);
+  ASSERT_EQ(other.size(), 1);
+  EXPECT_EQ(*other.begin(), "c");
+}
+
+TEST(Set, CopyIsIndependent) {
+  s21::set<int> our_set = {1, 2, 3};
+  s21::set<int> copy(our_set);
+  copy.insert(4);
+  EXPECT_EQ(our_set.size(), 3);
+  EXPECT_EQ(copy.size(), 4);
+  our_set = copy;
+  EXPECT_EQ(our_set.size(), 4);
+}
+
+TEST(Multiset, KeepsDuplicatesInInsertionOrder) {
+  s21::multiset<int> our_set = {3, 1, 3, 2, 3};
+  EXPECT_EQ(our_set.size(), 5);
+  EXPECT_EQ(our_set.count(3), 3);
+  EXPECT_EQ(our_set.count(4), 0);
+  auto range = our_set.equal_range(3);
+  EXPECT_EQ(std::distance(range.first, range.second), 3);
+  EXPECT_EQ(*our_set.lower_bound(2), 2);
+  EXPECT_TRUE(our_set.upper_bound(3) == our_set.end());
+  EXPECT_EQ(our_set.erase(3), 3);
+  EXPECT_EQ(our_set.size(), 2);
+}
+
+TEST(Multiset, InsertManyAndMerge) {
+  s21::multiset<int> our_set;
+  auto result = our_set.insert_many(2, 2, 1);
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_TRUE(result[1].second);
+  EXPECT_EQ(*our_set.begin(), 1);
+  s21::multiset<int> other = {2, 5};
+  our_set.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(our_set.count(2), 3);
+  EXPECT_EQ(our_set.size(), 5);
+}
+
+TEST(Multiset, HintKeepsOrder) {
+  s21::multiset<int> our_set;
+  for (int i = 0; i < 50; ++i) our_set.insert(our_set.end(), i / 5);
+  our_set.insert(our_set.begin(), 7);
+  our_set.insert(our_set.find(3), 3);
+  EXPECT_TRUE(std::is_sorted(our_set.begin(), our_set.end()));
+  EXPECT_EQ(our_set.count(7), 6);
+  EXPECT_EQ(our_set.count(3), 6);
+}
+
+
+TEST(FlatSet, BuildsSortedUniqueFromUnsortedRange) {
+  std::vector<int> source = {5, 3, 9, 3, 1, 5, 7};
+  s21::flat_set<int> our_set(source.begin(), source.end());
+  EXPECT_EQ(std::vector<int>(our_set.begin(), our_set.end()), (std::vector<int>{1, 3, 5, 7, 9}));
+  our_set.insert(source.begin(), source.begin() + 2);
+  EXPECT_EQ(our_set.size(), 5);
+  std::vector<int> more = {8, 0, 8};
+  our_set.insert(more.begin(), more.end());
+  EXPECT_EQ(std::vector<int>(our_set.begin(), our_set.end()), (std::vector<int>{0, 1, 3, 5, 7, 8, 9}));
+}
+
+TEST(FlatSet, LookupMatchesStdSet) {
+  std::mt19937 gen(3);
+  std::vector<int> source;
+  for (int i = 0; i < 1000; ++i) source.push_back(static_cast<int>(gen() % 3000));
+  s21::flat_set<int> our_set(source.begin(), source.end());
+  std::set<int> std_set(source.begin(), source.end());
+  ASSERT_EQ(our_set.size(), std_set.size());
+  for (int key = -1; key <= 3001; ++key) {
+    EXPECT_EQ(our_set.contains(key), std_set.count(key) == 1);
+    auto lower = std_set.lower_bound(key);
+    auto upper = std_set.upper_bound(key);
+    EXPECT_EQ(our_set.lower_bound(key) - our_set.begin(), std::distance(std_set.begin(), lower));
+    EXPECT_EQ(our_set.upper_bound(key) - our_set.begin(), std::distance(std_set.begin(), upper));
+  }
+}
+
+TEST(FlatSet, SingleInsertAndErase) {
+  s21::flat_set<std::string> our_set = {"b", "d"};
+  EXPECT_TRUE(our_set.insert("c").second);
+  EXPECT_FALSE(our_set.insert("b").second);
+  EXPECT_EQ(*our_set.find("c"), "c");
+  EXPECT_EQ(our_set.erase("b"), 1);
+  EXPECT_EQ(our_set.erase("x"), 0);
+  auto result = our_set.insert_many("a", "d", "e");
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(*result[2].first, "e");
+  EXPECT_EQ(std::vector<std::string>(our_set.begin(), our_set.end()),
+            (std::vector<std::string>{"a", "c", "d", "e"}));
+}
+
+TEST(FlatMap, BuildKeepsFirstOfEqualKeys) {
+  s21::flat_map<int, std::string> our_map = {{3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}};
+  ASSERT_EQ(our_map.size(), 3);
+  EXPECT_EQ(our_map.at(3), "c");
+  EXPECT_EQ(our_map.keys()[0], 1);
+  EXPECT_EQ(our_map.values()[2], "c");
+  std::vector<std::pair<int, std::string>> more = {{2, "y"}, {0, "z"}};
+  our_map.insert(more.begin(), more.end());
+  EXPECT_EQ(our_map.size(), 4);
+  EXPECT_EQ(our_map.at(2), "b");
+  EXPECT_EQ(our_map.begin()->second, "z");
+  EXPECT_THROW(our_map.at(10), std::out_of_range);
+}
+
+// ключи с кучей: повтор ищется до того, как ключи перемещены в словарь
+TEST(FlatMap, BuildKeepsFirstOfEqualStringKeys) {
+  s21::flat_map<std::string, int> our_map = {{"apple", 1}, {"apple", 2}, {"bob", 3}};
+  ASSERT_EQ(our_map.size(), 2);
+  EXPECT_EQ(our_map.at("apple"), 1);
+  EXPECT_EQ(our_map.at("bob"), 3);
+  std::vector<std::pair<std::string, int>> more = {
+      {"cat", 4}, {"bob", 5}, {"cat", 6}, {"apple", 7}, {"ant", 8}, {"ant", 9}};
+  our_map.insert(more.begin(), more.end());
+  std::map<std::string, int> expected = {{"apple", 1}, {"bob", 3}};
+  expected.insert(more.begin(), more.end());
+  ASSERT_EQ(our_map.size(), expected.size());
+  auto it = our_map.begin();
+  for (const auto& item : expected) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ(it->second, item.second);
+    ++it;
+  }
+}
+
+// значения копируются, пока перемещение может бросить: исключение на
+// любом шаге оставляет словарь прежним
+TEST(FlatMap, ThrowingRangeInsertLeavesMapIntact) {
+  s21::flat_map<std::string, copy_bomb> our_map;
+  copy_bomb::countdown = 0;
+  for (int i = 0; i < 4; ++i) our_map.insert(std::string(1, static_cast<char>('b' + 2 * i)), copy_bomb(i));
+  std::vector<std::pair<std::string, copy_bomb>> more;
+  more.emplace_back("a", copy_bomb(10));
+  more.emplace_back("e", copy_bomb(11));
+  bool inserted = false;
+  for (int countdown = 1; !inserted; ++countdown) {
+    copy_bomb::countdown = countdown;
+    try {
+      our_map.insert(more.begin(), more.end());
+      inserted = true;
+    } catch (const std::runtime_error&) {
+      ASSERT_EQ(our_map.size(), 4);
+      for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(our_map.keys()[i], std::string(1, static_cast<char>('b' + 2 * i)));
+        EXPECT_EQ(our_map.values()[i].value, static_cast<int>(i));
+      }
+    }
+  }
+  copy_bomb::countdown = 0;
+  EXPECT_EQ(our_map.size(), 6);
+  EXPECT_EQ(our_map.at("a").value, 10);
+  EXPECT_EQ(our_map.at("d").value, 1);
+}
+
+TEST(FlatMap, IteratorsAndModifiers) {
+  s21::flat_map<int, int> our_map;
+  our_map[5] = 50;
+  our_map[1] = 10;
+  EXPECT_TRUE(our_map.insert(3, 30).second);
+  EXPECT_FALSE(our_map.insert({3, 0}).second);
+  EXPECT_FALSE(our_map.insert_or_assign(1, 11).second);
+  std::vector<int> keys;
+  for (auto item : our_map) {
+    keys.push_back(item.first);
+    item.second += 1;
+  }
+  EXPECT_EQ(keys, (std::vector<int>{1, 3, 5}));
+  EXPECT_EQ(our_map.at(1), 12);
+  auto it = our_map.find(3);
+  EXPECT_EQ((*it).second, 31);
+  it = our_map.erase(it);
+  EXPECT_EQ(it->first, 5);
+  EXPECT_EQ(our_map.erase(7), 0);
+  EXPECT_TRUE(our_map.find(3) == our_map.end());
+  auto result = our_map.insert_many(std::make_pair(2, 20), std::make_pair(5, 0));
+  EXPECT_TRUE(result[0].second);
+  EXPECT_EQ(result[1].first->second, 51);
+  const auto& const_map = our_map;
+  EXPECT_EQ(const_map.lower_bound(3)->first, 5);
+  EXPECT_EQ(const_map.end() - const_map.begin(), 3);
+}
+
+
+TEST(UnorderedMap, RandomOperationsMatchStd) {
+  std::mt19937 gen(17);
+  s21::unordered_map<int, int> our_map;
+  std::unordered_map<int, int> std_map;
+  for (int step = 0; step < 200000; ++step) {
+    int key = static_cast<int>(gen() % 5000);
+    switch (gen() % 4) {
+      case 0:
+      case 1:
+        EXPECT_EQ(our_map.insert({key, step}).second, std_map.insert({key, step}).second);
+        break;
+      case 2:
+        EXPECT_EQ(our_map.erase(key), std_map.erase(key));
+        break;
+      default:
+        EXPECT_EQ(our_map.contains(key), std_map.count(key) == 1);
+    }
+  }
+  ASSERT_EQ(our_map.size(), std_map.size());
+  EXPECT_LE(our_map.load_factor(), our_map.max_load_factor());
+  size_t visited = 0;
+  for (const auto& item : our_map) {
+    EXPECT_EQ(std_map.at(item.first), item.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, std_map.size());
+}
+
+// все ключи в одной цепочке: поиск идёт через несколько полных групп
+struct CollidingHash {
+  size_t operator()(int) const { return 0; }
+};
+
+TEST(UnorderedMap, CollisionsAndErasedSlots) {
+  s21::unordered_map<int, std::string, CollidingHash> our_map;
+  for (int i = 0; i < 100; ++i) our_map[i] = std::to_string(i);
+  for (int i = 0; i < 100; i += 2) EXPECT_EQ(our_map.erase(i), 1);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(our_map.contains(i), i % 2 == 1);
+  EXPECT_EQ(our_map.at(51), "51");
+  for (int i = 100; i < 150; ++i) our_map.insert(i, std::to_string(i));
+  EXPECT_EQ(our_map.size(), 100);
+  for (int i = 100; i < 150; ++i) EXPECT_EQ(our_map.find(i)->second, std::to_string(i));
+  EXPECT_THROW(our_map.at(0), std::out_of_range);
+}
+
+TEST(UnorderedMap, ChurnDoesNotGrowTable) {
+  s21::unordered_map<int, int> our_map;
+  our_map.reserve(1000);
+  size_t buckets = our_map.bucket_count();
+  EXPECT_GE(buckets * our_map.max_load_factor(), 1000);
+  for (int i = 0; i < 1000; ++i) our_map[i] = i;
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 1000; ++i) our_map.erase(round * 1000 + i);
+    for (int i = 0; i < 1000; ++i) our_map[(round + 1) * 1000 + i] = i;
+  }
+  EXPECT_EQ(our_map.size(), 1000);
+  EXPECT_EQ(our_map.bucket_count(), buckets);
+  our_map.max_load_factor(0.5f);
+  EXPECT_LE(our_map.load_factor(), 0.5f);
+  EXPECT_EQ(our_map.at(50500), 500);
+  our_map.rehash(0);
+  EXPECT_EQ(our_map.size(), 1000);
+  our_map.clear();
+  EXPECT_TRUE(our_map.empty());
+  EXPECT_TRUE(our_map.begin() == our_map.end());
+}
+
+TEST(UnorderedMap, CopyMoveAndModifiers) {
+  s21::unordered_map<std::string, int> our_map = {{"a", 1}, {"b", 2}, {"a", 3}};
+  EXPECT_EQ(our_map.size(), 2);
+  EXPECT_EQ(our_map["a"], 1);
+  EXPECT_FALSE(our_map.insert_or_assign("b", 20).second);
+  EXPECT_TRUE(our_map.try_emplace("c", 30).second);
+  EXPECT_FALSE(our_map.emplace("c", 0).second);
+  s21::unordered_map<std::string, int> copy(our_map);
+  copy.erase(copy.find("a"));
+  EXPECT_EQ(our_map.size(), 3);
+  EXPECT_EQ(copy.size(), 2);
+  s21::unordered_map<std::string, int> moved(std::move(copy));
+  EXPECT_EQ(moved.at("b"), 20);
+  EXPECT_TRUE(copy.empty());
+  auto result = moved.insert_many(std::make_pair("d", 4), std::make_pair("b", 0));
+  EXPECT_EQ(result[0].first->second, 4);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(result[1].first->second, 20);
+  moved.swap(our_map);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_EQ(our_map.size(), 3);
+}
+
+struct StringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view value) const { return std::hash<std::string_view>()(value); }
+};
+
+struct StringEqual {
+  using is_transparent = void;
+  bool operator()(std::string_view lhs, std::string_view rhs) const { return lhs == rhs; }
+};
+
+// при неравных аллокаторах без propagate массивы чужие: значения
+// переносятся в свои массивы, таблица остаётся на своей арене
+TEST(UnorderedMap, MoveAssignRespectsAllocatorPropagation) {
+  using arena_alloc = arena_allocator<std::pair<const std::string, std::string>>;
+  using arena_map = s21::unordered_map<std::string, std::string, std::hash<std::string>,
+                                       std::equal_to<std::string>, arena_alloc>;
+  static_assert(!std::is_nothrow_move_assignable<arena_map>::value, "may move value-wise");
+  {
+    arena_map source(0, std::hash<std::string>(), std::equal_to<std::string>(), arena_alloc(1));
+    for (int i = 0; i < 40; ++i) source.insert({std::to_string(i), std::string(32, 'a' + i % 26)});
+    arena_map target(0, std::hash<std::string>(), std::equal_to<std::string>(), arena_alloc(2));
+    target.insert({"x", "y"});
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().arena, 2);
+    ASSERT_EQ(target.size(), 40);
+    EXPECT_EQ(target.at("7"), std::string(32, 'h'));
+    EXPECT_FALSE(target.contains("x"));
+    EXPECT_TRUE(source.empty());
+    source.insert({"z", "z"});
+
+    arena_map same(0, std::hash<std::string>(), std::equal_to<std::string>(), arena_alloc(2));
+    same.insert({"s", "t"});
+    target = std::move(same);
+    EXPECT_EQ(target.size(), 1);
+    EXPECT_EQ(target.at("s"), "t");
+  }
+  EXPECT_EQ(arena_live[1], 0);
+  EXPECT_EQ(arena_live[2], 0);
+}
+
+TEST(UnorderedMap, HeterogeneousLookup) {
+  s21::unordered_map<std::string, int, StringHash, StringEqual> our_map = {{"alpha", 1}, {"beta", 2}};
+  std::string_view key = "beta";
+  EXPECT_EQ(our_map.find(key)->second, 2);
+  EXPECT_TRUE(our_map.contains("alpha"));
+  EXPECT_EQ(our_map.count(std::string_view("gamma")), 0);
+}
+
+TEST(UnorderedSet, BasicOperations) {
+  std::vector<int> source = {4, 8, 15, 16, 23, 42, 8, 4};
+  s21::unordered_set<int> our_set(source.begin(), source.end());
+  EXPECT_EQ(our_set.size(), 6);
+  EXPECT_TRUE(our_set.contains(15));
+  EXPECT_FALSE(our_set.insert(42).second);
+  auto next = our_set.erase(our_set.find(23));
+  EXPECT_TRUE(next == our_set.end() || *next != 23);
+  EXPECT_EQ(our_set.count(23), 0);
+  std::set<int> seen(our_set.begin(), our_set.end());
+  EXPECT_EQ(seen, (std::set<int>{4, 8, 15, 16, 42}));
+  auto result = our_set.insert_many(1, 4);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_EQ(*result[1].first, 4);
+  EXPECT_THROW(our_set.erase(our_set.end()), std::out_of_range);
+}
+
+
+TEST(RingBuffer, RandomOperationsMatchDeque) {
+  std::mt19937 gen(5);
+  s21::ring_buffer<std::string> ring;
+  std::deque<std::string> expected;
+  for (int step = 0; step < 20000; ++step) {
+    std::string value = std::to_string(step);
+    switch (gen() % 5) {
+      case 0: ring.push_back(value); expected.push_back(value); break;
+      case 1: ring.push_front(value); expected.push_front(value); break;
+      case 2:
+        if (!expected.empty()) { ring.pop_front(); expected.pop_front(); }
+        break;
+      case 3:
+        if (!expected.empty()) { ring.pop_back(); expected.pop_back(); }
+        break;
+      default:
+        ring.emplace_back(3, 'x'); expected.emplace_back(3, 'x');
+    }
+    ASSERT_EQ(ring.size(), expected.size());
+  }
+  EXPECT_TRUE(std::equal(ring.begin(), ring.end(), expected.begin(), expected.end()));
+  EXPECT_EQ((ring.capacity() & (ring.capacity() - 1)), 0);
+}
+
+TEST(RingBuffer, WrapsAroundAndGrows) {
+  s21::ring_buffer<int> ring;
+  ring.reserve(5);
+  EXPECT_EQ(ring.capacity(), 8);
+  for (int i = 0; i < 6; ++i) ring.push_back(i);
+  for (int i = 0; i < 4; ++i) ring.pop_front();
+  for (int i = 6; i < 12; ++i) ring.push_back(i);
+  EXPECT_EQ(ring.capacity(), 8);
+  ring.push_back(ring.front());
+  EXPECT_EQ(ring.capacity(), 16);
+  EXPECT_EQ(std::vector<int>(ring.begin(), ring.end()), (std::vector<int>{4, 5, 6, 7, 8, 9, 10, 11, 4}));
+  s21::ring_buffer<int> copy(ring);
+  copy.pop_back();
+  EXPECT_EQ(ring.back(), 4);
+  EXPECT_EQ(copy.back(), 11);
+  ring.clear();
+  EXPECT_THROW(ring.pop_front(), std::out_of_range);
+  EXPECT_THROW(ring.pop_back(), std::out_of_range);
+}
+
+// аллокатор со своим construct: при росте буфера он должен вызываться
+// и для тривиально копируемых элементов
+template <typename T>
+struct constructing_allocator : std::allocator<T> {
+  static int constructs;
+  template <typename U>
+  struct rebind {
+    using other = constructing_allocator<U>;
+  };
+  constructing_allocator() = default;
+  template <typename U>
+  constructing_allocator(const constructing_allocator<U>&) {}
+  template <typename U, typename... Args>
+  void construct(U* p, Args&&... args) {
+    ++constructs;
+    ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+  }
+};
+
+template <typename T>
+int constructing_allocator<T>::constructs = 0;
+
+TEST(RingBuffer, GrowthUsesAllocatorConstruct) {
+  s21::ring_buffer<int, constructing_allocator<int>> ring;
+  constructing_allocator<int>::constructs = 0;
+  for (int i = 0; i < 9; ++i) ring.push_back(i);
+  EXPECT_EQ(ring.capacity(), 16);
+  EXPECT_EQ(constructing_allocator<int>::constructs, 9 + 8);
+  EXPECT_EQ(std::vector<int>(ring.begin(), ring.end()), (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8}));
+}
+
+TEST(RingBuffer, MoveAssignRespectsAllocatorPropagation) {
+  using arena_ring = s21::ring_buffer<std::string, arena_allocator<std::string>>;
+  static_assert(!std::is_nothrow_move_assignable<arena_ring>::value, "may move element-wise");
+  {
+    arena_ring source(arena_allocator<std::string>(1));
+    for (int i = 0; i < 5; ++i) source.push_back(std::to_string(i));
+    source.push_front("front");
+    arena_ring target(arena_allocator<std::string>(2));
+    target.push_back("x");
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().arena, 2);
+    EXPECT_EQ(std::vector<std::string>(target.begin(), target.end()),
+              (std::vector<std::string>{"front", "0", "1", "2", "3", "4"}));
+    EXPECT_TRUE(source.empty());
+    source.push_back("again");
+
+    arena_ring same(arena_allocator<std::string>(2));
+    same.push_back("s");
+    target = std::move(same);
+    EXPECT_EQ(target.size(), 1);
+    EXPECT_EQ(target.front(), "s");
+  }
+  EXPECT_EQ(arena_live[1], 0);
+  EXPECT_EQ(arena_live[2], 0);
+}
+
+TEST(Queue, FifoOverRingBufferAndList) {
+  s21::queue<int> our_queue = {1, 2, 3};
+  our_queue.push(4);
+  our_queue.insert_many_back(5, 6);
+  EXPECT_EQ(our_queue.front(), 1);
+  EXPECT_EQ(our_queue.back(), 6);
+  our_queue.pop();
+  EXPECT_EQ(our_queue.front(), 2);
+  EXPECT_EQ(our_queue.size(), 5);
+
+  s21::queue<int, s21::list<int>> list_queue;
+  list_queue.insert_many_back(7, 8);
+  list_queue.pop();
+  EXPECT_EQ(list_queue.front(), 8);
+  list_queue.pop();
+  EXPECT_TRUE(list_queue.empty());
+  EXPECT_THROW(list_queue.pop(), std::out_of_range);
+}
+
+TEST(Stack, LifoOverRingBufferAndVector) {
+  s21::stack<std::string> our_stack;
+  our_stack.push("a");
+  our_stack.insert_many_front("b", "c");
+  EXPECT_EQ(our_stack.top(), "c");
+  our_stack.pop();
+  EXPECT_EQ(our_stack.top(), "b");
+  s21::stack<std::string> other = {"x"};
+  our_stack.swap(other);
+  EXPECT_EQ(our_stack.size(), 1);
+  EXPECT_EQ(other.size(), 2);
+
+  s21::stack<int, s21::vector<int>> vector_stack;
+  vector_stack.insert_many_front(1, 2, 3);
+  vector_stack.emplace(4);
+  EXPECT_EQ(vector_stack.top(), 4);
+  vector_stack.pop();
+  EXPECT_EQ(vector_stack.top(), 3);
+  EXPECT_EQ(vector_stack.size(), 3);
+}
+
+
+TEST(SpscQueue, SingleThreadedBoundsAndBulk) {
+  s21::spsc_queue<std::string> queue(3);
+  EXPECT_EQ(queue.capacity(), 4);
+  EXPECT_TRUE(queue.try_push("a"));
+  EXPECT_TRUE(queue.try_emplace(2, 'b'));
+  std::vector<std::string> more = {"c", "d", "e"};
+  EXPECT_EQ(queue.push_bulk(more.begin(), more.size()), 2);
+  EXPECT_FALSE(queue.try_push("f"));
+  std::string value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "a");
+  std::vector<std::string> out(4);
+  EXPECT_EQ(queue.pop_bulk(out.begin(), out.size()), 3);
+  EXPECT_EQ(out[0], "bb");
+  EXPECT_EQ(out[2], "d");
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.try_push("left for destructor"));
+}
+
+TEST(SpscQueue, ProducerConsumerKeepOrder) {
+  constexpr int kItems = 200000;
+  s21::spsc_queue<int> queue(64);
+  std::thread producer([&queue] {
+    int next = 0;
+    int batch[16];
+    while (next < kItems) {
+      size_t pushed = 0;
+      if (next % 3 == 0) {
+        int count = std::min(16, kItems - next);
+        for (int i = 0; i < count; ++i) batch[i] = next + i;
+        pushed = queue.push_bulk(batch, static_cast<size_t>(count));
+      } else if (queue.try_push(next)) {
+        pushed = 1;
+      }
+      next += static_cast<int>(pushed);
+      if (pushed == 0) std::this_thread::yield();
+    }
+  });
+  int expected = 0;
+  bool ordered = true;
+  int batch[8];
+  while (expected < kItems) {
+    size_t count = queue.pop_bulk(batch, 8);
+    for (size_t i = 0; i < count; ++i) ordered = ordered && batch[i] == expected++;
+    if (count == 0) std::this_thread::yield();
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(queue.size_approx(), 0);
+}
+
+TEST(MpmcQueue, ManyProducersManyConsumers) {
+  constexpr int kProducers = 4;
+  constexpr int kConsumers = 4;
+  constexpr int kPerProducer = 50000;
+  s21::mpmc_queue<long long> queue(128);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&queue, p] {
+      long long base = static_cast<long long>(p) * kPerProducer;
+      int sent = 0;
+      long long batch[8];
+      while (sent < kPerProducer) {
+        if (p % 2 == 0) {
+          int count = std::min(8, kPerProducer - sent);
+          for (int i = 0; i < count; ++i) batch[i] = base + sent + i;
+          size_t pushed = queue.push_bulk(batch, static_cast<size_t>(count));
+          sent += static_cast<int>(pushed);
+          if (pushed == 0) std::this_thread::yield();
+        } else if (queue.try_push(base + sent)) {
+          ++sent;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  std::vector<std::vector<long long>> received(kConsumers);
+  std::atomic<int> remaining(kProducers * kPerProducer);
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&queue, &received, &remaining, c] {
+      long long batch[8];
+      while (remaining.load() > 0) {
+        size_t count = 0;
+        if (c % 2 == 0) {
+          count = queue.pop_bulk(batch, 8);
+        } else if (queue.try_pop(batch[0])) {
+          count = 1;
+        }
+        for (size_t i = 0; i < count; ++i) received[static_cast<size_t>(c)].push_back(batch[i]);
+        if (count == 0) std::this_thread::yield();
+        remaining -= static_cast<int>(count);
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  std::vector<int> seen(kProducers * kPerProducer, 0);
+  for (const auto& part : received) {
+    // внутри одного производителя порядок сохраняется и у каждого потребителя
+    std::vector<long long> last(kProducers, -1);
+    for (long long value : part) {
+      ++seen[static_cast<size_t>(value)];
+      long long& previous = last[static_cast<size_t>(value / kPerProducer)];
+      EXPECT_LT(previous, value);
+      previous = value;
+    }
+  }
+  EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), kProducers * kPerProducer);
+  long long value;
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(ThreadPool, ParallelForVisitsEachIndexOnce) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(pool.concurrency(), 4u);
+  std::vector<std::atomic<int>> visits(1000);
+  pool.parallel_for(0, visits.size(), [&visits](std::size_t i) { ++visits[i]; });
+  for (const auto& count : visits) EXPECT_EQ(count.load(), 1);
+  pool.parallel_for(5, 5, [](std::size_t) { FAIL(); });
+}
+
+TEST(ThreadPool, NestedInvokeSumsTree) {
+  s21::thread_pool pool(3);
+  std::function<long long(long long, long long)> sum = [&](long long first, long long last) -> long long {
+    if (last - first <= 16) {
+      long long total = 0;
+      for (long long i = first; i < last; ++i) total += i;
+      return total;
+    }
+    long long middle = first + (last - first) / 2, left = 0, right = 0;
+    pool.invoke([&] { left = sum(first, middle); }, [&] { right = sum(middle, last); });
+    return left + right;
+  };
+  EXPECT_EQ(sum(0, 100000), 100000LL * 99999 / 2);
+}
+
+TEST(ThreadPool, ExceptionReachesCaller) {
+  for (std::size_t threads : {1u, 4u}) {
+    s21::thread_pool pool(threads);
+    std::atomic<int> finished(0);
+    EXPECT_THROW(pool.parallel_for(0, 64,
+                                   [&finished](std::size_t i) {
+                                     if (i == 17) throw std::out_of_range("task");
+                                     ++finished;
+                                   }),
+                 std::out_of_range);
+    // пул после исключения остаётся рабочим
+    finished = 0;
+    pool.parallel_for(0, 64, [&finished](std::size_t) { ++finished; });
+    EXPECT_EQ(finished.load(), 64);
+  }
+}
+
+
+// алгоритмы с политиками: результат par/par_unseq на списке и векторе
+// должен совпадать с seq на тех же данных
+std::vector<int> AlgorithmValues(std::size_t n) {
+  std::vector<int> values;
+  std::mt19937 gen(22);
+  for (std::size_t i = 0; i < n; ++i) values.push_back(static_cast<int>(gen() % 1000) - 500);
+  return values;
+}
+
+template <typename Container, typename Policy>
+void CheckAlgorithms(const Policy& policy, std::size_t n) {
+  const std::vector<int> values = AlgorithmValues(n);
+  Container container;
+  for (int value : values) container.push_back(value);
+  auto isNegative = [](int value) { return value < 0; };
+
+  EXPECT_EQ(s21::reduce(policy, container.begin(), container.end(), 7LL),
+            std::accumulate(values.begin(), values.end(), 7LL));
+  EXPECT_EQ(s21::reduce(policy, container.begin(), container.end()),
+            std::accumulate(values.begin(), values.end(), 0));
+  EXPECT_EQ(s21::reduce(policy, container.begin(), container.end(), 0,
+                        [](int a, int b) { return std::max(a, b); }),
+            values.empty() ? 0 : std::max(0, *std::max_element(values.begin(), values.end())));
+  EXPECT_EQ(s21::count_if(policy, container.begin(), container.end(), isNegative),
+            std::count_if(values.begin(), values.end(), isNegative));
+
+  auto found = s21::find_if(policy, container.begin(), container.end(), [](int value) { return value == 499; });
+  auto expected = std::find_if(values.begin(), values.end(), [](int value) { return value == 499; });
+  EXPECT_EQ(std::distance(container.begin(), found), std::distance(values.begin(), expected));
+  EXPECT_TRUE(s21::find_if(policy, container.begin(), container.end(), [](int value) { return value > 1000; }) ==
+              container.end());
+
+  // выход — список: итераторы выхода двигаются проходом
+  s21::list<long long> doubled(values.size());
+  auto doubledEnd = s21::transform(policy, container.begin(), container.end(), doubled.begin(),
+                                   [](int value) { return 2LL * value; });
+  EXPECT_TRUE(doubledEnd == doubled.end());
+  auto source = values.begin();
+  for (long long value : doubled) EXPECT_EQ(value, 2LL * *source++);
+
+  std::vector<int> negatives(values.size());
+  auto negativesEnd = s21::copy_if(policy, container.begin(), container.end(), negatives.begin(), isNegative);
+  std::vector<int> expectedNegatives;
+  std::copy_if(values.begin(), values.end(), std::back_inserter(expectedNegatives), isNegative);
+  negatives.erase(negativesEnd, negatives.end());
+  EXPECT_EQ(negatives, expectedNegatives);
+
+  s21::for_each(policy, container.begin(), container.end(), [](int& value) { value += 1; });
+  source = values.begin();
+  for (int value : container) EXPECT_EQ(value, *source++ + 1);
+}
+
+TEST(Algorithms, SequencedMatchesStd) {
+  CheckAlgorithms<s21::list<int>>(s21::execution::seq, 1000);
+  CheckAlgorithms<s21::vector<int>>(s21::execution::seq, 1000);
+}
+
+TEST(Algorithms, ParallelOnListAndVector) {
+  for (std::size_t threads : {1u, 4u}) {
+    s21::thread_pool pool(threads);
+    for (std::size_t n : {std::size_t(0), std::size_t(5), std::size_t(100000)}) {
+      CheckAlgorithms<s21::list<int>>(s21::execution::par.on(pool), n);
+      CheckAlgorithms<s21::vector<int>>(s21::execution::par_unseq.on(pool), n);
+    }
+  }
+}
+
+TEST(Algorithms, FindIfReturnsFirstOfManyHits) {
+  s21::thread_pool pool(4);
+  s21::vector<int> values;
+  for (int i = 0; i < 200000; ++i) values.push_back(i % 50000 == 49999 ? 1 : 0);
+  auto hit = s21::find_if(s21::execution::par.on(pool), values.begin(), values.end(),
+                          [](int value) { return value == 1; });
+  EXPECT_EQ(hit - values.begin(), 49999);
+}
+
+// векторные ядра сверяются со скалярным результатом на всех длинах хвоста
+// и смещениях начала; каждый доступный уровень проверяется напрямую
+template <typename T>
+std::vector<T> SimdValues(std::size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<T> values;
+  for (std::size_t i = 0; i < n; ++i) values.push_back(static_cast<T>(static_cast<int>(gen() % 61) - 30));
+  return values;
+}
+
+template <typename T>
+void CheckSimdLevel(s21::simd_level level) {
+  for (std::size_t n : {0u, 1u, 3u, 7u, 8u, 15u, 16u, 17u, 31u, 33u, 64u, 65u, 1000u}) {
+    for (std::size_t shift = 0; shift < 3 && shift <= n; ++shift) {
+      std::vector<T> values = SimdValues<T>(n, static_cast<unsigned>(n * 7 + shift));
+      const T* first = values.data() + shift;
+      const T* last = values.data() + n;
+      const T needle = static_cast<T>(13);
+      const T* found = s21::simd_find(first, last, needle);
+      std::size_t counted = s21::simd_count(first, last, needle);
+      T sum = s21::simd_sum(first, last);
+      std::vector<T> copy(first, last);
+      bool equal = s21::simd_equal(first, last, copy.data());
+#if S21_SIMD_X86
+      if (level == s21::simd_level::avx2) {
+        found = s21::findAvx2(first, last, needle);
+        counted = s21::countAvx2(first, last, needle);
+        sum = s21::sumAvx2(first, last);
+        equal = s21::equalAvx2(first, last, copy.data());
+      } else if (level == s21::simd_level::sse42) {
+        found = s21::findSse42(first, last, needle);
+        counted = s21::countSse42(first, last, needle);
+        sum = s21::sumSse42(first, last);
+        equal = s21::equalSse42(first, last, copy.data());
+      }
+#endif
+      EXPECT_EQ(found, std::find(first, last, needle));
+      EXPECT_EQ(counted, static_cast<std::size_t>(std::count(first, last, needle)));
+      EXPECT_EQ(sum, s21::scalarSum(first, last));
+      EXPECT_TRUE(equal);
+      if (!copy.empty()) {
+        copy[copy.size() / 2] = static_cast<T>(copy[copy.size() / 2] + 1);
+        EXPECT_FALSE(s21::simd_equal(first, last, copy.data()));
+#if S21_SIMD_X86
+        if (level == s21::simd_level::avx2) {
+          EXPECT_FALSE(s21::equalAvx2(first, last, copy.data()));
+        } else if (level == s21::simd_level::sse42) {
+          EXPECT_FALSE(s21::equalSse42(first, last, copy.data()));
+        }
+#endif
+        std::pair<T, T> bounds = s21::simd_minmax(first, last);
+#if S21_SIMD_X86
+        if (level == s21::simd_level::avx2) bounds = s21::minMaxAvx2(first, last);
+        if (level == s21::simd_level::sse42) bounds = s21::minMaxSse42(first, last);
+#endif
+        EXPECT_EQ(bounds.first, *std::min_element(first, last));
+        EXPECT_EQ(bounds.second, *std::max_element(first, last));
+        std::fill(copy.begin(), copy.end(), T());
+#if S21_SIMD_X86
+        if (level == s21::simd_level::avx2) s21::fillAvx2(copy.data(), copy.data() + copy.size(), needle);
+        if (level == s21::simd_level::sse42) s21::fillSse42(copy.data(), copy.data() + copy.size(), needle);
+#endif
+        if (level == s21::simd_level::scalar) s21::simd_fill(copy.data(), copy.data() + copy.size(), needle);
+        EXPECT_EQ(static_cast<std::size_t>(std::count(copy.begin(), copy.end(), needle)), copy.size());
+      }
+    }
+  }
+}
+
+template <typename T>
+void CheckSimdAllLevels() {
+  CheckSimdLevel<T>(s21::simd_level::scalar);
+#if S21_SIMD_X86
+  if (__builtin_cpu_supports("sse4.2")) CheckSimdLevel<T>(s21::simd_level::sse42);
+  if (__builtin_cpu_supports("avx2")) CheckSimdLevel<T>(s21::simd_level::avx2);
+#endif
+}
+
+TEST(Simd, KernelsMatchScalar) {
+  CheckSimdAllLevels<std::int32_t>();
+  CheckSimdAllLevels<std::int64_t>();
+  CheckSimdAllLevels<float>();
+  CheckSimdAllLevels<double>();
+  CheckSimdAllLevels<std::int8_t>();
+  CheckSimdAllLevels<std::uint16_t>();
+}
+
+TEST(Simd, CountBeyondNarrowCounterRange) {
+  // 8-битные счётчики дорожек переполнились бы без промежуточного сброса
+  std::vector<std::int8_t> values(100000, 5);
+  values[777] = 6;
+  EXPECT_EQ(s21::simd_count(values.data(), values.data() + values.size(), std::int8_t(5)), 99999u);
+}
+
+TEST(Simd, FloatEqualityFollowsOperator) {
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> left(40, 1.0f), right(40, 1.0f);
+  left[3] = 0.0f;
+  right[3] = -0.0f;
+  EXPECT_TRUE(s21::simd_equal(left.data(), left.data() + 40, right.data()));
+  left[35] = right[35] = nan;
+  EXPECT_FALSE(s21::simd_equal(left.data(), left.data() + 40, right.data()));
+  std::vector<float> sum(1000, 0.1f);
+  EXPECT_NEAR(s21::simd_sum(sum.data(), sum.data() + sum.size()), 100.0f, 1e-3f);
+}
+
+TEST(Simd, VectorEqualityAndStrings) {
+  s21::vector<int> first = {1, 2, 3}, second = {1, 2, 3}, longer = {1, 2, 3, 4};
+  EXPECT_TRUE(first == second);
+  EXPECT_TRUE(first != longer);
+  second[2] = 4;
+  EXPECT_FALSE(first == second);
+  s21::vector<std::string> words = {"a", "b"}, same = {"a", "b"};
+  EXPECT_TRUE(words == same);
+  std::string text[] = {"x", "y", "z"};
+  EXPECT_EQ(s21::simd_find(text, text + 3, std::string("y")), text + 1);
+  EXPECT_EQ(s21::simd_count(text, text + 3, std::string("q")), 0u);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();